@@ -38,6 +38,29 @@ int knapsack(int W, const vector<int>& weights, const vector<int>& values, int n
     return dp[n][W];
 }
 
+// Top-down version (recursion + memoization)
+// best value from items i..n-1 with capacity w; memo[i][w] = -1 if not computed yet
+int knapsackMemo(int i, int w, const vector<int>& weights, const vector<int>& values, vector<vector<int>>& memo) {
+    // Base case: no items left
+    if (i == (int)weights.size()) {
+        return 0;
+    }
+    
+    // If already computed, return stored value
+    if (memo[i][w] != -1) {
+        return memo[i][w];
+    }
+    
+    // Skip item i, or take it if it fits
+    int best = knapsackMemo(i + 1, w, weights, values, memo);
+    if (weights[i] <= w) {
+        best = max(best, values[i] + knapsackMemo(i + 1, w - weights[i], weights, values, memo));
+    }
+    
+    memo[i][w] = best;
+    return best;
+}
+
 // Space-optimized version (using 1D array)
 int knapsackOptimized(int W, const vector<int>& weights, const vector<int>& values, int n) {
     vector<int> dp(W + 1, 0);
@@ -70,6 +93,10 @@ int main() {
     int maxValue = knapsack(W, weights, values, n);
     cout << "\nMaximum value (2D DP): " << maxValue << endl;
     
+    vector<vector<int>> memo(n, vector<int>(W + 1, -1));
+    int maxValueMemo = knapsackMemo(0, W, weights, values, memo);
+    cout << "Maximum value (Memoization): " << maxValueMemo << endl;
+    
     int maxValueOpt = knapsackOptimized(W, weights, values, n);
     cout << "Maximum value (Optimized): " << maxValueOpt << endl;
     
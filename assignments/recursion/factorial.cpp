@@ -6,11 +6,28 @@
  * 
  * Time Complexity: O(n)
  * Space Complexity: O(n) - due to recursion stack
+ * 
+ * long long holds n! only up to 20! (21! > 2^63) and overflows without
+ * any warning; exact values beyond that need big integers (see the
+ * product tree and prime swing engines in projects/big_numbers).
+ * 
+ * Factorial Tables modulo a prime p (nCr / nPr in O(1)):
+ * - fact[i] = fact[i-1] * i mod p, for i = 1..N
+ * - invFact[N] = fact[N]^(p-2) mod p (Fermat's little theorem), the only
+ *   modular inverse needed
+ * - invFact[i-1] = invFact[i] * i mod p (backward pass)
+ * - nCr = fact[n] * invFact[r] * invFact[n-r],  nPr = fact[n] * invFact[n-r]
+ * - Building: O(N + log p), each query: O(1)
  */
 
 #include <iostream>
+#include <vector>
+#include <algorithm>
 using namespace std;
 
+// Largest n with n! < 2^63
+const int FACTORIAL_LONG_LONG_MAX_N = 20;
+
 // Recursive Factorial
 long long factorialRecursive(int n) {
     // Base case
@@ -31,6 +48,55 @@ long long factorialIterative(int n) {
     return result;
 }
 
+// Prime modulus for the factorial tables
+const long long MOD = 1000000007;
+
+// (base^exponent) mod p by repeated squaring - O(log exponent)
+long long powerMod(long long base, long long exponent, long long p) {
+    long long result = 1;
+    base %= p;
+    while (exponent > 0) {
+        if (exponent % 2 == 1) {
+            result = result * base % p;
+        }
+        base = base * base % p;
+        exponent /= 2;
+    }
+    return result;
+}
+
+// Factorial and inverse factorial tables mod p up to maxN (maxN < p)
+void buildFactorialTables(int maxN, long long p, vector<long long>& fact, vector<long long>& invFact) {
+    fact.assign(maxN + 1, 1);
+    invFact.assign(maxN + 1, 1);
+    
+    for (int i = 1; i <= maxN; i++) {
+        fact[i] = fact[i - 1] * i % p;
+    }
+    
+    // One inverse, then walk down
+    invFact[maxN] = powerMod(fact[maxN], p - 2, p);
+    for (int i = maxN; i > 0; i--) {
+        invFact[i - 1] = invFact[i] * i % p;
+    }
+}
+
+// nCr mod p from the tables - O(1)
+long long binomialMod(int n, int r, long long p, const vector<long long>& fact, const vector<long long>& invFact) {
+    if (r < 0 || r > n) {
+        return 0;
+    }
+    return fact[n] * invFact[r] % p * invFact[n - r] % p;
+}
+
+// nPr mod p from the tables - O(1)
+long long permutationsMod(int n, int r, long long p, const vector<long long>& fact, const vector<long long>& invFact) {
+    if (r < 0 || r > n) {
+        return 0;
+    }
+    return fact[n] * invFact[n - r] % p;
+}
+
 int main() {
     int n;
     cout << "Enter a number: ";
@@ -40,9 +106,24 @@ int main() {
         cout << "Factorial is not defined for negative numbers" << endl;
         return 1;
     }
+    if (n > FACTORIAL_LONG_LONG_MAX_N) {
+        cout << "Warning: " << n << "! does not fit in long long (largest is "
+             << FACTORIAL_LONG_LONG_MAX_N << "!), the results below overflow" << endl;
+    }
     
     cout << "\nFactorial (Recursive): " << factorialRecursive(n) << endl;
     cout << "Factorial (Iterative): " << factorialIterative(n) << endl;
     
+    vector<long long> fact, invFact;
+    buildFactorialTables(n, MOD, fact, invFact);
+    cout << "\nFactorial mod " << MOD << " (Table): " << fact[n] << endl;
+    
+    cout << "C(" << n << ", r) mod " << MOD << " for r = 0.." << min(n, 10) << ": ";
+    for (int r = 0; r <= min(n, 10); r++) {
+        cout << binomialMod(n, r, MOD, fact, invFact) << " ";
+    }
+    cout << endl;
+    cout << "P(" << n << ", " << n / 2 << ") mod " << MOD << ": " << permutationsMod(n, n / 2, MOD, fact, invFact) << endl;
+    
     return 0;
 }
@@ -8,9 +8,17 @@
  * Space Complexity: O(n) - due to recursion stack
  * 
  * Note: This is inefficient. Use Dynamic Programming for better performance.
+ * 
+ * int overflows past F(46) (and unsigned long long past F(93)) without
+ * any warning; exact values beyond that need big integers.
+ * 
+ * Fast Doubling (fibonacciFastDoubling):
+ * - F(2k) = F(k) * (2F(k+1) - F(k)),  F(2k+1) = F(k)^2 + F(k+1)^2
+ * - Recurses on n / 2, so only O(log n) steps instead of n
  */
 
 #include <iostream>
+#include <utility>
 using namespace std;
 
 // Recursive Fibonacci
@@ -40,6 +48,25 @@ int fibonacciIterative(int n) {
     return curr;
 }
 
+// Fast Doubling - returns the pair (F(n), F(n+1)), exact up to F(93)
+pair<unsigned long long, unsigned long long> fibonacciFastDoubling(int n) {
+    // Base case
+    if (n == 0) {
+        return make_pair(0ULL, 1ULL);
+    }
+    
+    // (F(k), F(k+1)) for k = n / 2
+    pair<unsigned long long, unsigned long long> half = fibonacciFastDoubling(n / 2);
+    unsigned long long a = half.first, b = half.second;
+    
+    unsigned long long even = a * (2 * b - a);   // F(2k)
+    unsigned long long odd = a * a + b * b;      // F(2k+1)
+    if (n % 2 == 0) {
+        return make_pair(even, odd);
+    }
+    return make_pair(odd, even + odd);
+}
+
 int main() {
     int n;
     cout << "Enter the number of terms: ";
@@ -57,5 +84,11 @@ int main() {
     }
     cout << endl;
     
+    cout << "\nFibonacci Sequence (Fast Doubling):" << endl;
+    for (int i = 0; i < n; i++) {
+        cout << fibonacciFastDoubling(i).first << " ";
+    }
+    cout << endl;
+    
     return 0;
 }
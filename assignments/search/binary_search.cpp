@@ -9,6 +9,12 @@
  * Space Complexity: O(1) - iterative, O(log n) - recursive
  * 
  * Requirement: Array must be sorted
+ * 
+ * Branchless Lower Bound (lowerBoundBranchless):
+ * - Returns the first index whose element is >= target
+ * - No data-dependent branch: each step halves the range and moves the
+ *   base with a conditional move, so there are no branch mispredictions
+ * - Always exactly ceil(log2(n)) steps, found or not
  */
 
 #include <iostream>
@@ -65,6 +71,21 @@ int binarySearchRecursive(const vector<int>& arr, int target, int left, int righ
     return -1;
 }
 
+// Branchless Lower Bound - first index with arr[i] >= target (arr.size() if none)
+int lowerBoundBranchless(const vector<int>& arr, int target) {
+    int n = arr.size();
+    if (n == 0) return 0;
+    
+    const int* base = arr.data();
+    while (n > 1) {
+        int half = n / 2;
+        // Compiles to a conditional move instead of a branch
+        base = (base[half] < target) ? base + half : base;
+        n -= half;
+    }
+    return (base - arr.data()) + (*base < target);
+}
+
 int main() {
     // Sorted array (required for binary search)
     vector<int> arr = {11, 12, 22, 25, 34, 64, 90};
@@ -93,5 +114,13 @@ int main() {
         cout << "Element not found (Recursive)" << endl;
     }
     
+    // Branchless lower bound
+    int bound = lowerBoundBranchless(arr, target);
+    if (bound < (int)arr.size() && arr[bound] == target) {
+        cout << "Element found at index (Branchless): " << bound << endl;
+    } else {
+        cout << "Element not found (Branchless), insert position: " << bound << endl;
+    }
+    
     return 0;
 }
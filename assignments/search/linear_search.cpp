@@ -9,6 +9,12 @@
  * Space Complexity: O(1)
  * 
  * No requirement for sorted array
+ * 
+ * Blocked Linear Search (linearSearchBlocked):
+ * - Checks blocks of 8 elements with no branch inside the block, so the
+ *   compiler can compare several elements per instruction (SIMD)
+ * - Only a block that contains the target is searched element by element,
+ *   so the first match is still returned
  */
 
 #include <iostream>
@@ -17,8 +23,10 @@ using namespace std;
 
 // Linear Search function
 int linearSearch(const vector<int>& arr, int target) {
+    int n = arr.size();
+    
     // Traverse through all elements
-    for (int i = 0; i < arr.size(); i++) {
+    for (int i = 0; i < n; i++) {
         // If target is found, return index
         if (arr[i] == target) {
             return i;
@@ -29,6 +37,32 @@ int linearSearch(const vector<int>& arr, int target) {
     return -1;
 }
 
+// Blocked Linear Search - same result as linearSearch, 8 elements per step
+int linearSearchBlocked(const vector<int>& arr, int target) {
+    const int BLOCK = 8;
+    int n = arr.size();
+    int i = 0;
+    
+    for (; i + BLOCK <= n; i += BLOCK) {
+        // No early exit inside the block: all 8 comparisons are independent
+        bool found = false;
+        for (int j = 0; j < BLOCK; j++) {
+            found |= (arr[i + j] == target);
+        }
+        if (found) {
+            break;
+        }
+    }
+    
+    // Locate the match inside the block (or check the leftover elements)
+    for (; i < n; i++) {
+        if (arr[i] == target) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 int main() {
     // Array (doesn't need to be sorted)
     vector<int> arr = {64, 34, 25, 12, 22, 11, 90};
@@ -49,5 +83,13 @@ int main() {
         cout << "Element not found" << endl;
     }
     
+    result = linearSearchBlocked(arr, target);
+    
+    if (result != -1) {
+        cout << "Element found at index (Blocked): " << result << endl;
+    } else {
+        cout << "Element not found (Blocked)" << endl;
+    }
+    
     return 0;
 }
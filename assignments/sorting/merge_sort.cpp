@@ -9,12 +9,22 @@
  * Space Complexity: O(n)
  * 
  * Divide and Conquer Algorithm
+ * 
+ * Bottom-Up Variant (mergeSortBottomUp):
+ * - Allocates one scratch buffer per sort (or reuses one from the caller)
+ * - Merges back and forth between the array and the buffer (ping-pong),
+ *   so nothing is copied back after each level
+ * - Small blocks are sorted with insertion sort first
  */
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
 using namespace std;
 
+// Blocks up to this size are sorted with insertion sort before merging
+const int INSERTION_BLOCK_SIZE = 32;
+
 // Function to print array
 void printArray(const vector<int>& arr) {
     for (int num : arr) {
@@ -83,6 +93,76 @@ void mergeSort(vector<int>& arr, int left, int right) {
     }
 }
 
+// Insertion sort on arr[left..right] (used for small blocks)
+void insertionSortRange(int* arr, int left, int right) {
+    for (int i = left + 1; i <= right; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= left && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+// Merge src[left..mid-1] and src[mid..right-1] into dst[left..right-1]
+void mergeRuns(const int* src, int* dst, int left, int mid, int right) {
+    int i = left, j = mid, k = left;
+    
+    while (i < mid && j < right) {
+        if (src[i] <= src[j]) {
+            dst[k++] = src[i++];
+        } else {
+            dst[k++] = src[j++];
+        }
+    }
+    
+    // Copy remaining elements
+    while (i < mid) dst[k++] = src[i++];
+    while (j < right) dst[k++] = src[j++];
+}
+
+// Bottom-Up Merge Sort using a caller-provided scratch buffer
+// The buffer is grown to arr.size() if needed and can be reused across sorts
+void mergeSortBottomUp(vector<int>& arr, vector<int>& buffer) {
+    int n = arr.size();
+    if (n < 2) {
+        return;
+    }
+    if ((int)buffer.size() < n) {
+        buffer.resize(n);
+    }
+    
+    // Sort small blocks in place
+    for (int left = 0; left < n; left += INSERTION_BLOCK_SIZE) {
+        insertionSortRange(arr.data(), left, min(left + INSERTION_BLOCK_SIZE, n) - 1);
+    }
+    
+    // Merge runs of doubling width, swapping source and destination each pass
+    int* src = arr.data();
+    int* dst = buffer.data();
+    for (long long width = INSERTION_BLOCK_SIZE; width < n; width *= 2) {
+        for (long long left = 0; left < n; left += 2 * width) {
+            int mid = (int)min(left + width, (long long)n);
+            int right = (int)min(left + 2 * width, (long long)n);
+            mergeRuns(src, dst, (int)left, mid, right);
+        }
+        swap(src, dst);
+    }
+    
+    // After an odd number of passes the result is in the buffer
+    if (src != arr.data()) {
+        copy(src, src + n, arr.data());
+    }
+}
+
+// Bottom-Up Merge Sort that allocates a single scratch buffer per sort
+void mergeSortBottomUp(vector<int>& arr) {
+    vector<int> buffer(arr.size());
+    mergeSortBottomUp(arr, buffer);
+}
+
 int main() {
     // Test array
     vector<int> arr = {64, 34, 25, 12, 22, 11, 90};
@@ -96,6 +176,14 @@ int main() {
     cout << "\nSorted array:" << endl;
     printArray(arr);
     
+    // Bottom-up version with a single scratch buffer
+    vector<int> arr2 = {38, 27, 43, 3, 9, 82, 10};
+    vector<int> buffer;
+    mergeSortBottomUp(arr2, buffer);
+    
+    cout << "\nSorted array (Bottom-Up):" << endl;
+    printArray(arr2);
+    
     return 0;
 }
 
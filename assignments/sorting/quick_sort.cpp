@@ -9,12 +9,37 @@
  * Space Complexity: O(log n) - due to recursion
  * 
  * Divide and Conquer Algorithm
+ * 
+ * Introsort Variant (introSort):
+ * - Median-of-three pivot (ninther for large ranges), so sorted and
+ *   reverse-sorted input no longer hit the O(n²) case
+ * - Three-way partitioning (Bentley-McIlroy), so runs of equal keys are
+ *   excluded from further recursion
+ * - Recursion only into the smaller side: O(log n) stack depth
+ * - Insertion sort for small ranges
+ * - Heap sort fallback when recursion gets too deep: O(n log n) worst case
+ * 
+ * Block Partition (partitionBlock / quickSortBlock):
+ * - Same pivot and recursion as quickSort, branchless partition kernel
+ * - Offsets of misplaced elements are collected into small fixed blocks
+ *   without branching, then swapped in batches (BlockQuicksort)
+ * - Avoids the ~50% branch mispredictions of partition() on random keys
  */
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
 using namespace std;
 
+// Ranges up to this size are finished with insertion sort
+const int INSERTION_THRESHOLD = 16;
+
+// Number of elements scanned per block by partitionBlock
+const int PARTITION_BLOCK_SIZE = 64;
+
+// Ranges larger than this use the ninther (median of three medians)
+const int NINTHER_THRESHOLD = 128;
+
 // Function to print array
 void printArray(const vector<int>& arr) {
     for (int num : arr) {
@@ -44,6 +69,67 @@ int partition(vector<int>& arr, int low, int high) {
     return i + 1;
 }
 
+// Branchless block partition - same contract as partition()
+// Places pivot arr[high] in its final position and returns its index
+int partitionBlock(vector<int>& arr, int low, int high) {
+    int pivot = arr[high];
+    int* a = arr.data();
+    
+    // Invariant: a[low..l-1] <= pivot and a[r+1..high-1] > pivot
+    int l = low, r = high - 1;
+    
+    // Offsets of misplaced elements in the current left/right blocks
+    unsigned char offsetsLeft[PARTITION_BLOCK_SIZE];
+    unsigned char offsetsRight[PARTITION_BLOCK_SIZE];
+    int startLeft = 0, numLeft = 0;
+    int startRight = 0, numRight = 0;
+    
+    while (r - l + 1 >= 2 * PARTITION_BLOCK_SIZE) {
+        // Scan a block only when its buffer is empty; no branch on the comparison
+        if (numLeft == 0) {
+            startLeft = 0;
+            for (int i = 0; i < PARTITION_BLOCK_SIZE; i++) {
+                offsetsLeft[numLeft] = (unsigned char)i;
+                numLeft += (a[l + i] > pivot);
+            }
+        }
+        if (numRight == 0) {
+            startRight = 0;
+            for (int i = 0; i < PARTITION_BLOCK_SIZE; i++) {
+                offsetsRight[numRight] = (unsigned char)i;
+                numRight += (a[r - i] <= pivot);
+            }
+        }
+        
+        // Swap misplaced pairs in one batch
+        int num = min(numLeft, numRight);
+        for (int k = 0; k < num; k++) {
+            swap(a[l + offsetsLeft[startLeft + k]], a[r - offsetsRight[startRight + k]]);
+        }
+        numLeft -= num;
+        numRight -= num;
+        startLeft += num;
+        startRight += num;
+        
+        // A block is done once all its misplaced elements are swapped
+        if (numLeft == 0) l += PARTITION_BLOCK_SIZE;
+        if (numRight == 0) r -= PARTITION_BLOCK_SIZE;
+    }
+    
+    // Finish the remaining a[l..r] with a branchless Lomuto pass
+    int first = l;
+    for (int j = l; j <= r; j++) {
+        int value = a[j];
+        a[j] = a[first];
+        a[first] = value;
+        first += (value <= pivot);
+    }
+    
+    // Place pivot in correct position
+    swap(a[first], a[high]);
+    return first;
+}
+
 // Quick Sort function
 void quickSort(vector<int>& arr, int low, int high) {
     if (low < high) {
@@ -56,6 +142,164 @@ void quickSort(vector<int>& arr, int low, int high) {
     }
 }
 
+// Quick Sort using the block partition kernel
+void quickSortBlock(vector<int>& arr, int low, int high) {
+    if (low < high) {
+        int pi = partitionBlock(arr, low, high);
+        quickSortBlock(arr, low, pi - 1);
+        quickSortBlock(arr, pi + 1, high);
+    }
+}
+
+// Insertion sort on arr[low..high]
+void insertionSortRange(vector<int>& arr, int low, int high) {
+    for (int i = low + 1; i <= high; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= low && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+// Sift arr[low + root] down in the heap stored in arr[low..low+size-1]
+void siftDown(vector<int>& arr, int low, int root, int size) {
+    while (true) {
+        int largest = root;
+        int left = 2 * root + 1;
+        int right = left + 1;
+        
+        if (left < size && arr[low + left] > arr[low + largest]) {
+            largest = left;
+        }
+        if (right < size && arr[low + right] > arr[low + largest]) {
+            largest = right;
+        }
+        if (largest == root) {
+            return;
+        }
+        
+        swap(arr[low + root], arr[low + largest]);
+        root = largest;
+    }
+}
+
+// Heap sort on arr[low..high] (worst-case fallback for introSort)
+void heapSortRange(vector<int>& arr, int low, int high) {
+    int size = high - low + 1;
+    
+    // Build max heap
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        siftDown(arr, low, i, size);
+    }
+    
+    // Move the max to the end one element at a time
+    for (int end = size - 1; end > 0; end--) {
+        swap(arr[low], arr[low + end]);
+        siftDown(arr, low, 0, end);
+    }
+}
+
+// Index of the median of arr[a], arr[b], arr[c]
+int medianOfThree(const vector<int>& arr, int a, int b, int c) {
+    if (arr[a] < arr[b]) {
+        if (arr[b] < arr[c]) return b;
+        return (arr[a] < arr[c]) ? c : a;
+    }
+    if (arr[a] < arr[c]) return a;
+    return (arr[b] < arr[c]) ? c : b;
+}
+
+// Pivot selection: median-of-three, or ninther for large ranges
+int choosePivot(const vector<int>& arr, int low, int high) {
+    int n = high - low + 1;
+    int mid = low + n / 2;
+    
+    if (n > NINTHER_THRESHOLD) {
+        int step = n / 8;
+        int m1 = medianOfThree(arr, low, low + step, low + 2 * step);
+        int m2 = medianOfThree(arr, mid - step, mid, mid + step);
+        int m3 = medianOfThree(arr, high - 2 * step, high - step, high);
+        return medianOfThree(arr, m1, m2, m3);
+    }
+    return medianOfThree(arr, low, mid, high);
+}
+
+// Three-way partition (Bentley-McIlroy) around the pivot in arr[high]
+// Afterwards: arr[low..lessEnd] < pivot, arr[lessEnd+1..greaterStart-1] == pivot,
+// arr[greaterStart..high] > pivot
+void partition3Way(vector<int>& arr, int low, int high, int& lessEnd, int& greaterStart) {
+    int pivot = arr[high];
+    int i = low - 1, j = high;
+    int p = low - 1, q = high;  // Equal keys are parked at both ends
+    
+    while (true) {
+        while (arr[++i] < pivot);
+        while (pivot < arr[--j]) {
+            if (j == low) break;
+        }
+        if (i >= j) break;
+        
+        swap(arr[i], arr[j]);
+        if (arr[i] == pivot) swap(arr[++p], arr[i]);
+        if (arr[j] == pivot) swap(arr[--q], arr[j]);
+    }
+    
+    // Place the pivot, then move the parked equal keys next to it
+    swap(arr[i], arr[high]);
+    j = i - 1;
+    i = i + 1;
+    for (int k = low; k <= p; k++, j--) swap(arr[k], arr[j]);
+    for (int k = high - 1; k >= q; k--, i++) swap(arr[k], arr[i]);
+    
+    lessEnd = j;
+    greaterStart = i;
+}
+
+// Introsort main loop: recurse into the smaller side, loop on the larger
+void introSortLoop(vector<int>& arr, int low, int high, int depthLimit) {
+    while (high - low + 1 > INSERTION_THRESHOLD) {
+        // Too many bad pivots: switch to heap sort
+        if (depthLimit == 0) {
+            heapSortRange(arr, low, high);
+            return;
+        }
+        depthLimit--;
+        
+        swap(arr[choosePivot(arr, low, high)], arr[high]);
+        
+        int lessEnd, greaterStart;
+        partition3Way(arr, low, high, lessEnd, greaterStart);
+        
+        if (lessEnd - low < high - greaterStart) {
+            introSortLoop(arr, low, lessEnd, depthLimit);
+            low = greaterStart;
+        } else {
+            introSortLoop(arr, greaterStart, high, depthLimit);
+            high = lessEnd;
+        }
+    }
+    
+    insertionSortRange(arr, low, high);
+}
+
+// Introsort: same interface as quickSort, O(n log n) worst case
+void introSort(vector<int>& arr, int low, int high) {
+    if (low >= high) {
+        return;
+    }
+    
+    // Depth limit of 2 * floor(log2(n))
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) {
+        depthLimit += 2;
+    }
+    
+    introSortLoop(arr, low, high, depthLimit);
+}
+
 int main() {
     // Test array
     vector<int> arr = {64, 34, 25, 12, 22, 11, 90};
@@ -70,6 +314,20 @@ int main() {
     cout << "\nSorted array:" << endl;
     printArray(arr);
     
+    // Quick Sort with the block partition kernel
+    vector<int> arr3 = {64, 34, 25, 12, 22, 11, 90};
+    quickSortBlock(arr3, 0, arr3.size() - 1);
+    
+    cout << "\nSorted array (Block Partition):" << endl;
+    printArray(arr3);
+    
+    // Introsort on input with many duplicates
+    vector<int> arr2 = {5, 1, 5, 3, 5, 5, 2, 5, 1, 3, 5, 4, 5, 2, 5, 1, 5, 5, 3, 5};
+    introSort(arr2, 0, arr2.size() - 1);
+    
+    cout << "\nSorted array (Introsort):" << endl;
+    printArray(arr2);
+    
     return 0;
 }
 
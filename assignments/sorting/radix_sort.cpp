@@ -0,0 +1,119 @@
+/*
+ * Radix Sort Algorithm (LSD, 32-bit integer keys)
+ * 
+ * Time Complexity:
+ * - Best Case: O(n)
+ * - Average Case: O(n * d)
+ * - Worst Case: O(n * d) - d = number of digit passes (3 for 11-bit digits)
+ * 
+ * Space Complexity: O(n + 2^b) - b = bits per digit
+ * 
+ * Not comparison based: elements are distributed by their digits,
+ * least significant digit first. Each pass is stable.
+ * 
+ * Details:
+ * - 11-bit digits, so a 32-bit key needs only 3 passes
+ * - All digit histograms are counted in a single pass over the input
+ * - Passes where every key has the same digit are skipped
+ * - Signed keys: the sign bit is flipped so negatives sort first
+ * - Ping-pong between the array and one buffer (no copy per pass)
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+const int RADIX_BITS = 11;                       // Bits per digit
+const int RADIX_BUCKETS = 1 << RADIX_BITS;       // 2048 buckets per digit
+const int RADIX_PASSES = (32 + RADIX_BITS - 1) / RADIX_BITS;  // 3 passes
+const unsigned int RADIX_MASK = RADIX_BUCKETS - 1;
+
+// Function to print array
+void printArray(const vector<int>& arr) {
+    for (int num : arr) {
+        cout << num << " ";
+    }
+    cout << endl;
+}
+
+// Map a signed key to an unsigned key with the same order
+unsigned int radixKey(int value) {
+    return (unsigned int)value ^ 0x80000000u;
+}
+
+// LSD Radix Sort using a caller-provided buffer
+void radixSort(vector<int>& arr, vector<int>& buffer) {
+    int n = arr.size();
+    if (n < 2) {
+        return;
+    }
+    if ((int)buffer.size() < n) {
+        buffer.resize(n);
+    }
+    
+    // Count all digits in one pass
+    vector<int> counts(RADIX_PASSES * RADIX_BUCKETS, 0);
+    for (int i = 0; i < n; i++) {
+        unsigned int key = radixKey(arr[i]);
+        for (int pass = 0; pass < RADIX_PASSES; pass++) {
+            counts[pass * RADIX_BUCKETS + ((key >> (pass * RADIX_BITS)) & RADIX_MASK)]++;
+        }
+    }
+    
+    int* src = arr.data();
+    int* dst = buffer.data();
+    
+    for (int pass = 0; pass < RADIX_PASSES; pass++) {
+        int* count = &counts[pass * RADIX_BUCKETS];
+        int shift = pass * RADIX_BITS;
+        
+        // Skip the pass if every key has the same digit
+        if (count[(radixKey(src[0]) >> shift) & RADIX_MASK] == n) {
+            continue;
+        }
+        
+        // Convert counts into starting offsets (exclusive prefix sum)
+        int sum = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            int c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+        
+        // Stable scatter into the other buffer
+        for (int i = 0; i < n; i++) {
+            unsigned int digit = (radixKey(src[i]) >> shift) & RADIX_MASK;
+            dst[count[digit]++] = src[i];
+        }
+        
+        swap(src, dst);
+    }
+    
+    // After an odd number of passes the result is in the buffer
+    if (src != arr.data()) {
+        copy(src, src + n, arr.data());
+    }
+}
+
+// LSD Radix Sort that allocates its own buffer
+void radixSort(vector<int>& arr) {
+    vector<int> buffer(arr.size());
+    radixSort(arr, buffer);
+}
+
+int main() {
+    // Test array (including negative numbers)
+    vector<int> arr = {170, -45, 75, -90, 802, 24, 2, 66, -2147483647 - 1, 2147483647};
+    
+    cout << "Original array:" << endl;
+    printArray(arr);
+    
+    // Sort the array
+    radixSort(arr);
+    
+    cout << "\nSorted array:" << endl;
+    printArray(arr);
+    
+    return 0;
+}
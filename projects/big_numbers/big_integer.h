@@ -0,0 +1,443 @@
+/*
+ * Arbitrary-Precision Non-Negative Integers
+ *
+ * BigInteger stores a number as 32-bit limbs, least significant first, with
+ * no leading zero limbs (zero has no limbs). Only what the number engines
+ * need is provided: +, - (a >= b), *, shifts, comparison, division by a
+ * small number and decimal conversion.
+ *
+ * Multiplication:
+ *   - schoolbook O(n * m) below KARATSUBA_THRESHOLD limbs
+ *   - Karatsuba above it: three half-size products instead of four,
+ *     O(n^1.585)
+ *   - number-theoretic transform (NTT) above NTT_THRESHOLD limbs: the
+ *     operands are split into 16-bit digits and convolved modulo two
+ *     NTT-friendly primes, O(n log n); the two residues of every
+ *     coefficient are recombined by the Chinese remainder theorem
+ *   - very unbalanced operands are cut into pieces of the shorter length
+ *     so that every product handed to Karatsuba is balanced
+ *
+ * toString() is quadratic (repeated division by 10^9): fine for printing,
+ * not meant for numbers with tens of millions of digits.
+ */
+
+#ifndef BIG_INTEGER_H
+#define BIG_INTEGER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Operands with at least this many limbs (both) use Karatsuba
+const size_t KARATSUBA_THRESHOLD = 40;
+
+// Operands with at least this many limbs (both) use the NTT
+const size_t NTT_THRESHOLD = 1536;
+
+// NTT primes, both with primitive root 3: 119 * 2^23 + 1 and 7 * 2^26 + 1
+const uint32_t NTT_PRIME_1 = 998244353;
+const uint32_t NTT_PRIME_2 = 469762049;
+
+// Longest NTT the first prime allows (16-bit digits, so products up to
+// 2^22 limbs); longer products fall back to Karatsuba on NTT-sized pieces
+const size_t NTT_MAX_LENGTH = (size_t)1 << 23;
+
+class BigInteger {
+public:
+    typedef std::vector<uint32_t> Limbs;
+
+    BigInteger() {}
+
+    BigInteger(uint64_t value) {
+        while (value != 0) {
+            limbs.push_back((uint32_t)value);
+            value >>= 32;
+        }
+    }
+
+    bool isZero() const {
+        return limbs.empty();
+    }
+
+    size_t limbCount() const {
+        return limbs.size();
+    }
+
+    const Limbs& data() const {
+        return limbs;
+    }
+
+    // Number of bits (0 for zero)
+    uint64_t bitLength() const {
+        if (limbs.empty()) return 0;
+        uint32_t top = limbs.back();
+        int bits = 0;
+        while (top != 0) {
+            bits++;
+            top >>= 1;
+        }
+        return (uint64_t)(limbs.size() - 1) * 32 + bits;
+    }
+
+    // Number of decimal digits (1 for zero)
+    uint64_t decimalDigits() const {
+        if (limbs.empty()) return 1;
+        // log10 from the top 64 bits, then checked against the neighbouring power of ten
+        double estimate = log10Approx();
+        uint64_t digits = (uint64_t)estimate + 1;
+        if (estimate - std::floor(estimate) < 1e-9 || std::ceil(estimate) - estimate < 1e-9) {
+            digits = (uint64_t)toString().size();
+        }
+        return digits;
+    }
+
+    // log10 of the value, accurate to about 1e-15 relative (value > 0)
+    double log10Approx() const {
+        size_t n = limbs.size();
+        double top = limbs[n - 1];
+        if (n >= 2) top = top * 4294967296.0 + limbs[n - 2];
+        if (n >= 3) top = top * 4294967296.0 + limbs[n - 3];
+        size_t shifted = n >= 3 ? n - 3 : 0;
+        return std::log10(top) + shifted * 32 * std::log10(2.0);
+    }
+
+    friend bool operator==(const BigInteger& a, const BigInteger& b) {
+        return a.limbs == b.limbs;
+    }
+
+    friend bool operator!=(const BigInteger& a, const BigInteger& b) {
+        return a.limbs != b.limbs;
+    }
+
+    friend bool operator<(const BigInteger& a, const BigInteger& b) {
+        return compare(a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size()) < 0;
+    }
+
+    friend BigInteger operator+(const BigInteger& a, const BigInteger& b) {
+        BigInteger result = a;
+        result += b;
+        return result;
+    }
+
+    BigInteger& operator+=(const BigInteger& other) {
+        addShifted(limbs, other.limbs.data(), other.limbs.size(), 0);
+        return *this;
+    }
+
+    // a - b, requires a >= b
+    friend BigInteger operator-(const BigInteger& a, const BigInteger& b) {
+        BigInteger result = a;
+        result -= b;
+        return result;
+    }
+
+    BigInteger& operator-=(const BigInteger& other) {
+        subtractInPlace(limbs, other.limbs.data(), other.limbs.size());
+        return *this;
+    }
+
+    friend BigInteger operator*(const BigInteger& a, const BigInteger& b) {
+        BigInteger result;
+        result.limbs = multiply(a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size());
+        return result;
+    }
+
+    BigInteger& operator*=(const BigInteger& other) {
+        limbs = multiply(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+        return *this;
+    }
+
+    BigInteger operator<<(uint64_t bits) const {
+        if (limbs.empty()) return *this;
+        size_t whole = (size_t)(bits / 32);
+        int part = (int)(bits % 32);
+        BigInteger result;
+        result.limbs.assign(whole, 0);
+        uint32_t carry = 0;
+        for (uint32_t limb : limbs) {
+            result.limbs.push_back(part ? (limb << part) | carry : limb);
+            carry = part ? limb >> (32 - part) : 0;
+        }
+        if (carry) result.limbs.push_back(carry);
+        return result;
+    }
+
+    // Multiplies in place by a small number
+    void multiplySmall(uint32_t factor) {
+        if (factor == 0) {
+            limbs.clear();
+            return;
+        }
+        uint64_t carry = 0;
+        for (uint32_t& limb : limbs) {
+            uint64_t product = (uint64_t)limb * factor + carry;
+            limb = (uint32_t)product;
+            carry = product >> 32;
+        }
+        if (carry) limbs.push_back((uint32_t)carry);
+    }
+
+    // Divides in place by divisor (> 0), returns the remainder
+    uint32_t divideSmall(uint32_t divisor) {
+        uint64_t remainder = 0;
+        for (size_t i = limbs.size(); i-- > 0; ) {
+            uint64_t current = (remainder << 32) | limbs[i];
+            limbs[i] = (uint32_t)(current / divisor);
+            remainder = current % divisor;
+        }
+        trim(limbs);
+        return (uint32_t)remainder;
+    }
+
+    // Value modulo a small number
+    uint32_t modSmall(uint32_t divisor) const {
+        uint64_t remainder = 0;
+        for (size_t i = limbs.size(); i-- > 0; ) {
+            remainder = ((remainder << 32) | limbs[i]) % divisor;
+        }
+        return (uint32_t)remainder;
+    }
+
+    std::string toString() const {
+        if (limbs.empty()) return "0";
+        BigInteger rest = *this;
+        std::vector<uint32_t> chunks;   // base 10^9, least significant first
+        while (!rest.isZero()) chunks.push_back(rest.divideSmall(1000000000));
+
+        std::string text = std::to_string(chunks.back());
+        for (size_t i = chunks.size() - 1; i-- > 0; ) {
+            std::string chunk = std::to_string(chunks[i]);
+            text += std::string(9 - chunk.size(), '0') + chunk;
+        }
+        return text;
+    }
+
+    // Product of two limb arrays (leading zero limbs allowed), without leading zeros
+    static Limbs multiply(const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+        while (na > 0 && a[na - 1] == 0) na--;
+        while (nb > 0 && b[nb - 1] == 0) nb--;
+        if (na < nb) {
+            std::swap(a, b);
+            std::swap(na, nb);
+        }
+        Limbs result;
+        if (nb == 0) return result;
+
+        if (nb < KARATSUBA_THRESHOLD) {
+            result.assign(na + nb, 0);
+            multiplySchoolbook(a, na, b, nb, result.data());
+        } else if (nb >= NTT_THRESHOLD && nttLength(na, nb) <= NTT_MAX_LENGTH) {
+            result = multiplyNtt(a, na, b, nb);
+        } else if (2 * nb <= na) {
+            // Unbalanced: multiply b by pieces of a of b's length
+            for (size_t offset = 0; offset < na; offset += nb) {
+                Limbs piece = multiply(a + offset, std::min(nb, na - offset), b, nb);
+                addShifted(result, piece.data(), piece.size(), offset);
+            }
+        } else {
+            result = multiplyKaratsuba(a, na, b, nb);
+        }
+        trim(result);
+        return result;
+    }
+
+private:
+    static void trim(Limbs& value) {
+        while (!value.empty() && value.back() == 0) value.pop_back();
+    }
+
+    static int compare(const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+        if (na != nb) return na < nb ? -1 : 1;
+        for (size_t i = na; i-- > 0; ) {
+            if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    // value += addend << (32 * shift)
+    static void addShifted(Limbs& value, const uint32_t* addend, size_t count, size_t shift) {
+        if (count == 0) return;
+        if (value.size() < shift + count) value.resize(shift + count, 0);
+        uint64_t carry = 0;
+        size_t i = 0;
+        for (; i < count; i++) {
+            uint64_t sum = (uint64_t)value[shift + i] + addend[i] + carry;
+            value[shift + i] = (uint32_t)sum;
+            carry = sum >> 32;
+        }
+        for (size_t j = shift + i; carry != 0; j++) {
+            if (j == value.size()) value.push_back(0);
+            uint64_t sum = (uint64_t)value[j] + carry;
+            value[j] = (uint32_t)sum;
+            carry = sum >> 32;
+        }
+    }
+
+    // value -= subtrahend, requires value >= subtrahend
+    static void subtractInPlace(Limbs& value, const uint32_t* subtrahend, size_t count) {
+        int64_t borrow = 0;
+        size_t i = 0;
+        for (; i < count; i++) {
+            int64_t difference = (int64_t)value[i] - subtrahend[i] - borrow;
+            borrow = difference < 0;
+            value[i] = (uint32_t)(difference + (borrow << 32));
+        }
+        for (; borrow != 0 && i < value.size(); i++) {
+            int64_t difference = (int64_t)value[i] - borrow;
+            borrow = difference < 0;
+            value[i] = (uint32_t)(difference + (borrow << 32));
+        }
+        trim(value);
+    }
+
+    // out[0 .. na + nb) = a * b, out zeroed by the caller
+    static void multiplySchoolbook(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* out) {
+        for (size_t i = 0; i < na; i++) {
+            uint64_t carry = 0;
+            uint64_t digit = a[i];
+            for (size_t j = 0; j < nb; j++) {
+                uint64_t product = digit * b[j] + out[i + j] + carry;
+                out[i + j] = (uint32_t)product;
+                carry = product >> 32;
+            }
+            out[i + nb] = (uint32_t)carry;
+        }
+    }
+
+    // a = a1 * B^m + a0, b = b1 * B^m + b0 (nb > m, so both halves exist):
+    // a * b = z2 * B^2m + (z1 - z2 - z0) * B^m + z0, z1 = (a0 + a1) * (b0 + b1)
+    static Limbs multiplyKaratsuba(const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+        size_t m = na / 2;
+        Limbs z0 = multiply(a, m, b, m);
+        Limbs z2 = multiply(a + m, na - m, b + m, nb - m);
+
+        Limbs sumA(a, a + m);
+        addShifted(sumA, a + m, na - m, 0);
+        Limbs sumB(b, b + m);
+        addShifted(sumB, b + m, nb - m, 0);
+        Limbs z1 = multiply(sumA.data(), sumA.size(), sumB.data(), sumB.size());
+        subtractInPlace(z1, z0.data(), z0.size());
+        subtractInPlace(z1, z2.data(), z2.size());
+
+        Limbs result = z0;
+        result.reserve(na + nb);
+        addShifted(result, z1.data(), z1.size(), m);
+        addShifted(result, z2.data(), z2.size(), 2 * m);
+        return result;
+    }
+
+    // Transform length for a product of na + nb limbs (2 digits per limb)
+    static size_t nttLength(size_t na, size_t nb) {
+        size_t length = 1;
+        while (length < 2 * (na + nb)) length *= 2;
+        return length;
+    }
+
+    template <uint32_t Mod>
+    static uint32_t powMod(uint64_t base, uint64_t exponent) {
+        uint64_t result = 1;
+        base %= Mod;
+        while (exponent != 0) {
+            if (exponent & 1) result = result * base % Mod;
+            base = base * base % Mod;
+            exponent >>= 1;
+        }
+        return (uint32_t)result;
+    }
+
+    // In-place transform modulo Mod (length a power of two); the inverse
+    // transform includes the division by the length
+    template <uint32_t Mod>
+    static void ntt(std::vector<uint32_t>& values, bool inverse) {
+        size_t n = values.size();
+        if (n < 2) return;
+
+        // roots[k + j] = w^j, w a primitive 2k-th root of unity, j < k
+        std::vector<uint32_t> roots(n);
+        roots[1] = 1;
+        for (size_t k = 2; k < n; k *= 2) {
+            uint64_t step = powMod<Mod>(3, (Mod - 1) / (2 * k));
+            for (size_t i = k; i < 2 * k; i++) {
+                roots[i] = (i & 1) ? (uint32_t)(roots[i / 2] * step % Mod) : roots[i / 2];
+            }
+        }
+
+        for (size_t i = 1, j = 0; i < n; i++) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) j ^= bit;
+            j ^= bit;
+            if (i < j) std::swap(values[i], values[j]);
+        }
+
+        for (size_t k = 1; k < n; k *= 2) {
+            for (size_t i = 0; i < n; i += 2 * k) {
+                for (size_t j = 0; j < k; j++) {
+                    uint32_t z = (uint32_t)((uint64_t)roots[k + j] * values[i + j + k] % Mod);
+                    uint32_t x = values[i + j];
+                    values[i + j] = (x + z >= Mod) ? x + z - Mod : x + z;
+                    values[i + j + k] = (x >= z) ? x - z : x + Mod - z;
+                }
+            }
+        }
+
+        if (inverse) {
+            std::reverse(values.begin() + 1, values.end());
+            uint64_t scale = powMod<Mod>(n, Mod - 2);
+            for (uint32_t& value : values) value = (uint32_t)(value * scale % Mod);
+        }
+    }
+
+    // Cyclic convolution of the 16-bit digits of a and b modulo Mod
+    template <uint32_t Mod>
+    static std::vector<uint32_t> convolve(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                                          size_t length, bool square) {
+        std::vector<uint32_t> result(length, 0);
+        for (size_t i = 0; i < na; i++) {
+            result[2 * i] = a[i] & 0xFFFF;
+            result[2 * i + 1] = a[i] >> 16;
+        }
+        ntt<Mod>(result, false);
+        if (square) {
+            for (uint32_t& value : result) value = (uint32_t)((uint64_t)value * value % Mod);
+        } else {
+            std::vector<uint32_t> other(length, 0);
+            for (size_t i = 0; i < nb; i++) {
+                other[2 * i] = b[i] & 0xFFFF;
+                other[2 * i + 1] = b[i] >> 16;
+            }
+            ntt<Mod>(other, false);
+            for (size_t i = 0; i < length; i++) result[i] = (uint32_t)((uint64_t)result[i] * other[i] % Mod);
+        }
+        ntt<Mod>(result, true);
+        return result;
+    }
+
+    // Every coefficient is below min(2 na, 2 nb) * 2^32 <= 2^55 < NTT_PRIME_1 * NTT_PRIME_2,
+    // so the pair of residues identifies it; squares need one forward transform less
+    static Limbs multiplyNtt(const uint32_t* a, size_t na, const uint32_t* b, size_t nb) {
+        size_t length = nttLength(na, nb);
+        bool square = a == b && na == nb;
+        std::vector<uint32_t> first = convolve<NTT_PRIME_1>(a, na, b, nb, length, square);
+        std::vector<uint32_t> second = convolve<NTT_PRIME_2>(a, na, b, nb, length, square);
+
+        // x = r1 + p1 * ((r2 - r1) / p1 mod p2), then carries in base 2^16
+        const uint64_t inverse = powMod<NTT_PRIME_2>(NTT_PRIME_1, NTT_PRIME_2 - 2);
+        Limbs result(na + nb, 0);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < 2 * (na + nb); i++) {
+            uint64_t r1 = first[i];
+            uint64_t difference = (second[i] + (uint64_t)NTT_PRIME_2 - r1 % NTT_PRIME_2) % NTT_PRIME_2;
+            uint64_t coefficient = r1 + (uint64_t)NTT_PRIME_1 * (difference * inverse % NTT_PRIME_2);
+            uint64_t digit = coefficient + carry;
+            result[i / 2] |= (uint32_t)(digit & 0xFFFF) << (16 * (i & 1));
+            carry = digit >> 16;
+        }
+        return result;
+    }
+
+    Limbs limbs;
+};
+
+#endif
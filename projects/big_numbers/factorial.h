@@ -0,0 +1,159 @@
+/*
+ * Exact Factorials on Big Integers
+ *
+ * Multiplying 2, 3, ..., n into one growing number (factorialSequential)
+ * does n - 1 big-by-small products whose cost grows with the result:
+ * O(n^2) limb operations in total. Both engines below build the same
+ * product as a balanced tree instead, so most of the work is a few
+ * multiplications of two halves of similar size, where Karatsuba and the
+ * NTT pay off:
+ *
+ *   - factorialBinarySplit: the odd parts of 2..n (factors of two taken
+ *     out and applied as one shift at the end, n - popcount(n) bits),
+ *     packed into 32-bit words and multiplied as a product tree
+ *   - factorialPrimeSwing (Luschny): n! = 2^(n - popcount(n)) * odd(n),
+ *         odd(n) = odd(n / 2)^2 * swing(n)
+ *     where swing(n) = n! / (n / 2)!^2 has at most one power of each prime
+ *     p <= n, with exponent sum over k of floor(n / p^k) mod 2. Primes in
+ *     (n / 3, n / 2] drop out, primes above sqrt(n) appear at most once,
+ *     so the product trees hold about n / ln(n) small factors in total and
+ *     half of the work is squarings.
+ *
+ * With threads > 1 the two halves of every large tree node are multiplied
+ * on separate threads (the thread budget is halved at each level), and
+ * the prime swing computes odd(n / 2) and swing(n) concurrently. The last
+ * multiplication of a tree is one product and stays on a single thread,
+ * which bounds the speedup.
+ */
+
+#ifndef FACTORIAL_H
+#define FACTORIAL_H
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "big_integer.h"
+
+// Tree nodes with fewer factors than this are multiplied on the calling thread
+const size_t FACTORIAL_PARALLEL_MIN_FACTORS = 1024;
+
+// n! by n - 1 big-by-small products, O(n^2) (baseline)
+inline BigInteger factorialSequential(uint32_t n) {
+    BigInteger result(1);
+    for (uint64_t i = 2; i <= n; i++) result.multiplySmall((uint32_t)i);
+    return result;
+}
+
+// Multiply neighbouring factors together while the product fits in 32 bits
+inline std::vector<uint32_t> packFactors(const std::vector<uint32_t>& factors) {
+    std::vector<uint32_t> packed;
+    uint64_t word = 1;
+    for (uint32_t factor : factors) {
+        if (word * factor > 0xFFFFFFFFULL) {
+            packed.push_back((uint32_t)word);
+            word = 1;
+        }
+        word *= factor;
+    }
+    if (word > 1) packed.push_back((uint32_t)word);
+    return packed;
+}
+
+// Product of factors[begin, end) as a balanced tree, on up to threads threads
+inline BigInteger productTree(const std::vector<uint32_t>& factors, size_t begin, size_t end, int threads) {
+    if (end - begin <= 8) {
+        BigInteger result(1);
+        for (size_t i = begin; i < end; i++) result.multiplySmall(factors[i]);
+        return result;
+    }
+
+    size_t middle = begin + (end - begin) / 2;
+    BigInteger left, right;
+    if (threads > 1 && end - begin >= FACTORIAL_PARALLEL_MIN_FACTORS) {
+        int leftThreads = threads / 2;
+        std::thread worker([&]() { left = productTree(factors, begin, middle, leftThreads); });
+        right = productTree(factors, middle, end, threads - leftThreads);
+        worker.join();
+    } else {
+        left = productTree(factors, begin, middle, 1);
+        right = productTree(factors, middle, end, 1);
+    }
+    return left * right;
+}
+
+inline BigInteger productTree(const std::vector<uint32_t>& factors, int threads) {
+    return productTree(factors, 0, factors.size(), threads);
+}
+
+// Exponent of two in n!
+inline uint64_t factorialTwos(uint32_t n) {
+    uint64_t ones = 0;
+    for (uint32_t rest = n; rest != 0; rest >>= 1) ones += rest & 1;
+    return n - ones;
+}
+
+inline BigInteger factorialBinarySplit(uint32_t n, int threads = 1) {
+    std::vector<uint32_t> odd;
+    odd.reserve(n);
+    for (uint64_t i = 3; i <= n; i++) {
+        uint32_t factor = (uint32_t)i;
+        while (!(factor & 1)) factor >>= 1;
+        if (factor > 1) odd.push_back(factor);
+    }
+    return productTree(packFactors(odd), threads) << factorialTwos(n);
+}
+
+// Odd primes up to limit (sieve of Eratosthenes over odd numbers)
+inline std::vector<uint32_t> oddPrimesUpTo(uint32_t limit) {
+    std::vector<uint32_t> primes;
+    if (limit < 3) return primes;
+    std::vector<bool> composite(limit / 2 + 1, false);   // entry i stands for 2i + 1
+    for (uint64_t i = 1; 2 * i + 1 <= limit; i++) {
+        if (composite[i]) continue;
+        uint64_t p = 2 * i + 1;
+        primes.push_back((uint32_t)p);
+        for (uint64_t multiple = p * p; multiple <= limit; multiple += 2 * p) composite[multiple / 2] = true;
+    }
+    return primes;
+}
+
+// Odd part of swing(n) = n! / (n / 2)!^2, from the odd primes up to at least n
+inline BigInteger oddSwing(uint32_t n, const std::vector<uint32_t>& primes, int threads) {
+    std::vector<uint32_t> factors;
+    for (uint32_t p : primes) {
+        if (p > n) break;
+        if ((uint64_t)p * p > n) {
+            // One power at most: floor(n / p) odd
+            if ((n / p) & 1) factors.push_back(p);
+            continue;
+        }
+        uint64_t power = 1;
+        for (uint64_t q = n / p; q > 0; q /= p) {
+            if (q & 1) power *= p;
+        }
+        if (power > 1) factors.push_back((uint32_t)power);
+    }
+    return productTree(packFactors(factors), threads);
+}
+
+// Odd part of n!
+inline BigInteger oddFactorial(uint32_t n, const std::vector<uint32_t>& primes, int threads) {
+    if (n < 3) return BigInteger(1);
+    BigInteger half, swing;
+    if (threads > 1 && n >= FACTORIAL_PARALLEL_MIN_FACTORS) {
+        int halfThreads = threads / 2;
+        std::thread worker([&]() { half = oddFactorial(n / 2, primes, halfThreads); });
+        swing = oddSwing(n, primes, threads - halfThreads);
+        worker.join();
+    } else {
+        half = oddFactorial(n / 2, primes, 1);
+        swing = oddSwing(n, primes, 1);
+    }
+    return half * half * swing;
+}
+
+inline BigInteger factorialPrimeSwing(uint32_t n, int threads = 1) {
+    return oddFactorial(n, oddPrimesUpTo(n), threads) << factorialTwos(n);
+}
+
+#endif
@@ -0,0 +1,343 @@
+/*
+ * Factorial Tables Modulo a Prime (O(1) nCr / nPr)
+ *
+ * FactorialTable holds k! and (k!)^-1 mod p for every k <= maxN, so
+ *     C(n, r) = n! * (r!)^-1 * ((n - r)!)^-1   and   P(n, r) = n! * ((n - r)!)^-1
+ * are two or one modular products per query.
+ *
+ * Building is linear: the factorials by one product each, then a single
+ * modular inverse (Fermat, (maxN!)^(p - 2)) and a backward pass
+ *     ((k - 1)!)^-1 = (k!)^-1 * k
+ * which needs no further inverses. maxN must be below p (p! = 0 mod p).
+ *
+ * Products are reduced with Montgomery multiplication (p odd, below 2^31):
+ * reduce(t) = t / 2^32 mod p costs two multiplications and a shift instead
+ * of a 64-bit division by a modulus only known at run time. The inverse
+ * factorials are stored in Montgomery form (times 2^32 mod p) and the
+ * factorials in plain form, so every reduce(plain * montgomery) gives a
+ * plain result again and a query needs no conversion.
+ *
+ * Batched queries prefetch the table entries of the query
+ * FACTORIAL_TABLE_PREFETCH_DISTANCE positions ahead, so that for tables
+ * larger than the cache the random loads overlap instead of waiting one
+ * after another.
+ *
+ * Tables can be saved to a file (16-byte header + both arrays, native byte
+ * order) and loaded by mapping the file read-only: a restart costs an
+ * mmap, and only the pages that queries touch are read.
+ */
+
+#ifndef FACTORIAL_TABLE_H
+#define FACTORIAL_TABLE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FACTORIAL_TABLE_POSIX 1
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define FACTORIAL_TABLE_POSIX 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FACTORIAL_TABLE_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define FACTORIAL_TABLE_PREFETCH(address) ((void)(address))
+#endif
+
+// Queries between a prefetch and the lookup that uses it
+const size_t FACTORIAL_TABLE_PREFETCH_DISTANCE = 16;
+
+// First bytes of a saved table
+const char FACTORIAL_TABLE_MAGIC[8] = {'F', 'A', 'C', 'T', 'T', 'A', 'B', '1'};
+
+// Arithmetic modulo an odd modulus below 2^31 on Montgomery residues
+class Montgomery32 {
+public:
+    explicit Montgomery32(uint32_t modulus = 1) : mod(modulus) {
+        // -mod^-1 mod 2^32 by Newton's iteration (each step doubles the correct bits)
+        uint32_t inverse = modulus;
+        for (int i = 0; i < 5; i++) inverse *= 2 - modulus * inverse;
+        negativeInverse = 0 - inverse;
+        uint64_t r = ((uint64_t)1 << 32) % modulus;
+        rSquared = (uint32_t)(r * r % modulus);
+    }
+
+    uint32_t modulus() const {
+        return mod;
+    }
+
+    // t * 2^-32 mod p, for t < p * 2^32
+    uint32_t reduce(uint64_t t) const {
+        uint32_t m = (uint32_t)t * negativeInverse;
+        uint32_t u = (uint32_t)((t + (uint64_t)m * mod) >> 32);
+        return u >= mod ? u - mod : u;
+    }
+
+    uint32_t multiply(uint32_t a, uint32_t b) const {
+        return reduce((uint64_t)a * b);
+    }
+
+    uint32_t toMontgomery(uint32_t x) const {
+        return reduce((uint64_t)x * rSquared);
+    }
+
+    uint32_t fromMontgomery(uint32_t x) const {
+        return reduce(x);
+    }
+
+    // base^exponent, both and the result in Montgomery form
+    uint32_t power(uint32_t base, uint64_t exponent) const {
+        uint32_t result = toMontgomery(1);
+        while (exponent != 0) {
+            if (exponent & 1) result = multiply(result, base);
+            base = multiply(base, base);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+private:
+    uint32_t mod;
+    uint32_t negativeInverse;
+    uint32_t rSquared;   // 2^64 mod p
+};
+
+class FactorialTable {
+public:
+    FactorialTable() : factorials(nullptr), inverses(nullptr), largestN(0), mapping(nullptr), mappedBytes(0) {}
+
+    ~FactorialTable() {
+        release();
+    }
+
+    FactorialTable(const FactorialTable&) = delete;
+    FactorialTable& operator=(const FactorialTable&) = delete;
+
+    // k! and (k!)^-1 mod modulus for k <= maxN; false (see lastError) on bad arguments
+    bool build(uint32_t maxN, uint32_t modulus) {
+        release();
+        if (!checkModulus(modulus, maxN)) return false;
+        arithmetic = Montgomery32(modulus);
+        storage.assign(2 * ((size_t)maxN + 1), 0);
+        factorials = storage.data();
+        inverses = storage.data() + (size_t)maxN + 1;
+        largestN = maxN;
+
+        uint32_t* factorial = storage.data();
+        uint32_t* inverse = storage.data() + (size_t)maxN + 1;
+        const uint32_t one = arithmetic.toMontgomery(1);
+        uint32_t k = one;   // k in Montgomery form, advanced by adding one
+        factorial[0] = 1;
+        for (uint32_t i = 1; i <= maxN; i++) {
+            factorial[i] = arithmetic.multiply(factorial[i - 1], k);
+            k = addMod(k, one);
+        }
+
+        // The one inverse; k is now maxN + 1, walked back down in the backward pass
+        uint32_t top = arithmetic.toMontgomery(factorial[maxN]);
+        inverse[maxN] = arithmetic.power(top, modulus - 2);
+        for (uint32_t i = maxN; i > 0; i--) {
+            k = subtractMod(k, one);
+            inverse[i - 1] = arithmetic.multiply(inverse[i], k);
+        }
+        return true;
+    }
+
+    bool save(const std::string& path) {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) return fail("cannot create " + path);
+        uint32_t header[4];
+        std::memcpy(header, FACTORIAL_TABLE_MAGIC, sizeof(FACTORIAL_TABLE_MAGIC));
+        header[2] = arithmetic.modulus();
+        header[3] = largestN;
+        size_t entries = (size_t)largestN + 1;
+        bool ok = std::fwrite(header, sizeof(header), 1, file) == 1 &&
+                  std::fwrite(factorials, sizeof(uint32_t), entries, file) == entries &&
+                  std::fwrite(inverses, sizeof(uint32_t), entries, file) == entries;
+        if (std::fclose(file) != 0 || !ok) return fail("cannot write " + path);
+        return true;
+    }
+
+    // Tables saved by save(): mapped read-only where possible, read into memory otherwise
+    bool load(const std::string& path) {
+        release();
+#if FACTORIAL_TABLE_POSIX
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return fail("open " + path + ": " + std::strerror(errno));
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size < 16) {
+            ::close(fd);
+            return fail(path + ": not a factorial table");
+        }
+        void* file = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (file == MAP_FAILED) return fail("mmap " + path + ": " + std::strerror(errno));
+        mapping = file;
+        mappedBytes = (size_t)info.st_size;
+        return attach((const uint32_t*)file, mappedBytes, path);
+#else
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) return fail("cannot open " + path);
+        std::vector<uint32_t> contents;
+        uint32_t block[4096];
+        size_t count;
+        while ((count = std::fread(block, sizeof(uint32_t), 4096, file)) > 0) {
+            contents.insert(contents.end(), block, block + count);
+        }
+        std::fclose(file);
+        storage.swap(contents);
+        return attach(storage.data(), storage.size() * sizeof(uint32_t), path);
+#endif
+    }
+
+    // True when the tables live in a mapped file
+    bool isMapped() const {
+        return mapping != nullptr;
+    }
+
+    uint32_t maxN() const {
+        return largestN;
+    }
+
+    uint32_t modulus() const {
+        return arithmetic.modulus();
+    }
+
+    long long memoryBytes() const {
+        return 2 * ((long long)largestN + 1) * (long long)sizeof(uint32_t);
+    }
+
+    uint32_t factorial(uint32_t n) const {
+        return factorials[n];
+    }
+
+    uint32_t inverseFactorial(uint32_t n) const {
+        return arithmetic.fromMontgomery(inverses[n]);
+    }
+
+    // C(n, r) mod p, n <= maxN (0 for r > n)
+    uint32_t binomial(uint32_t n, uint32_t r) const {
+        if (r > n) return 0;
+        return arithmetic.multiply(arithmetic.multiply(factorials[n], inverses[r]), inverses[n - r]);
+    }
+
+    // P(n, r) = n! / (n - r)! mod p, n <= maxN (0 for r > n)
+    uint32_t permutations(uint32_t n, uint32_t r) const {
+        if (r > n) return 0;
+        return arithmetic.multiply(factorials[n], inverses[n - r]);
+    }
+
+    // results[i] = C(n[i], r[i]), loads of later queries prefetched
+    void binomialBatch(const uint32_t* n, const uint32_t* r, uint32_t* results, size_t count) const {
+        for (size_t i = 0; i < count; i++) {
+            if (i + FACTORIAL_TABLE_PREFETCH_DISTANCE < count) {
+                size_t ahead = i + FACTORIAL_TABLE_PREFETCH_DISTANCE;
+                FACTORIAL_TABLE_PREFETCH(factorials + n[ahead]);
+                FACTORIAL_TABLE_PREFETCH(inverses + r[ahead]);
+                FACTORIAL_TABLE_PREFETCH(inverses + (n[ahead] - r[ahead]));
+            }
+            results[i] = binomial(n[i], r[i]);
+        }
+    }
+
+    // results[i] = P(n[i], r[i]), loads of later queries prefetched
+    void permutationsBatch(const uint32_t* n, const uint32_t* r, uint32_t* results, size_t count) const {
+        for (size_t i = 0; i < count; i++) {
+            if (i + FACTORIAL_TABLE_PREFETCH_DISTANCE < count) {
+                size_t ahead = i + FACTORIAL_TABLE_PREFETCH_DISTANCE;
+                FACTORIAL_TABLE_PREFETCH(factorials + n[ahead]);
+                FACTORIAL_TABLE_PREFETCH(inverses + (n[ahead] - r[ahead]));
+            }
+            results[i] = permutations(n[i], r[i]);
+        }
+    }
+
+    const std::string& lastError() const {
+        return error;
+    }
+
+private:
+    uint32_t addMod(uint32_t a, uint32_t b) const {
+        uint32_t sum = a + b;   // < 2^32 for a, b < p < 2^31
+        return sum >= arithmetic.modulus() ? sum - arithmetic.modulus() : sum;
+    }
+
+    uint32_t subtractMod(uint32_t a, uint32_t b) const {
+        return a >= b ? a - b : a + arithmetic.modulus() - b;
+    }
+
+    bool checkModulus(uint32_t modulus, uint32_t maxN) {
+        if (modulus < 3 || modulus >= 0x80000000U || !(modulus & 1)) {
+            return fail("the modulus must be an odd prime below 2^31");
+        }
+        for (uint32_t d = 3; (uint64_t)d * d <= modulus; d += 2) {
+            if (modulus % d == 0) return fail("the modulus must be prime (" + std::to_string(d) + " divides it)");
+        }
+        if (maxN >= modulus) return fail("maxN must be below the modulus (p! = 0 mod p)");
+        return true;
+    }
+
+    // Point the tables into a saved image of bytes bytes, after checking its header
+    bool attach(const uint32_t* image, size_t bytes, const std::string& path) {
+        if (bytes < 16) {
+            release();
+            return fail(path + ": not a factorial table");
+        }
+        uint32_t modulus = image[2];
+        uint32_t maxN = image[3];
+        if (std::memcmp(image, FACTORIAL_TABLE_MAGIC, sizeof(FACTORIAL_TABLE_MAGIC)) != 0 ||
+            bytes != 16 + 2 * ((size_t)maxN + 1) * sizeof(uint32_t) || !checkModulus(modulus, maxN)) {
+            release();
+            return fail(path + ": not a factorial table (or a truncated one)");
+        }
+        arithmetic = Montgomery32(modulus);
+        factorials = image + 4;
+        inverses = image + 4 + (size_t)maxN + 1;
+        largestN = maxN;
+
+        // Spot check: k! * (k!)^-1 = 1
+        if (arithmetic.multiply(factorials[maxN], inverses[maxN]) != 1 ||
+            arithmetic.multiply(factorials[maxN / 2], inverses[maxN / 2]) != 1) {
+            release();
+            return fail(path + ": table entries do not match");
+        }
+        return true;
+    }
+
+    void release() {
+#if FACTORIAL_TABLE_POSIX
+        if (mapping) munmap(mapping, mappedBytes);
+#endif
+        mapping = nullptr;
+        mappedBytes = 0;
+        storage.clear();
+        factorials = nullptr;
+        inverses = nullptr;
+        largestN = 0;
+    }
+
+    bool fail(const std::string& what) {
+        error = what;
+        return false;
+    }
+
+    Montgomery32 arithmetic;
+    const uint32_t* factorials;   // k! mod p
+    const uint32_t* inverses;     // (k!)^-1 mod p, Montgomery form
+    uint32_t largestN;
+    std::vector<uint32_t> storage;   // built (or read) tables
+    void* mapping;                    // loaded tables
+    size_t mappedBytes;
+    std::string error;
+};
+
+#endif
@@ -0,0 +1,518 @@
+/*
+ * Big Number Algorithms Tool
+ *
+ * Exact Fibonacci numbers for n in the millions on arbitrary-precision
+ * integers (fast doubling + Karatsuba), F(n) mod m for 64-bit n and m,
+ * and a benchmark against the int and big-integer iterative versions.
+ *
+ * Exact factorials for n up to the millions: product trees (binary
+ * splitting) and the prime swing, Karatsuba / NTT multiplication and
+ * independent subtrees on several threads, against the sequential product.
+ *
+ * O(1) C(n, r) and P(n, r) mod p from factorial / inverse factorial tables
+ * (Montgomery reduction, batched queries), saved to a file and mapped back
+ * at startup instead of being rebuilt.
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+#include <sstream>
+#include <thread>
+#include <random>
+#include "big_integer.h"
+#include "factorial.h"
+#include "factorial_table.h"
+#include "fibonacci.h"
+using namespace std;
+using namespace std::chrono;
+
+// Iterative Fibonacci (from assignments/recursion/fibonacci.cpp), exact up to F(46)
+int fibonacciIterative(int n) {
+    if (n <= 1) {
+        return n;
+    }
+
+    int prev = 0, curr = 1;
+    for (int i = 2; i <= n; i++) {
+        int next = prev + curr;
+        prev = curr;
+        curr = next;
+    }
+
+    return curr;
+}
+
+// Largest n with F(n) < 2^31
+const int FIBONACCI_INT_MAX_N = 46;
+
+// Default prime for the factorial tables
+const uint32_t TABLE_DEFAULT_MODULUS = 1000000007;
+
+unsigned int inputSeed = 42;
+
+double elapsedMs(high_resolution_clock::time_point start) {
+    return duration_cast<microseconds>(high_resolution_clock::now() - start).count() / 1000.0;
+}
+
+// Average ns per call of run(), repeated for at least 10 ms
+template <typename Run>
+double averageNs(Run run) {
+    long long calls = 0;
+    auto start = high_resolution_clock::now();
+    do {
+        run();
+        calls++;
+    } while (high_resolution_clock::now() - start < milliseconds(10));
+    return duration_cast<nanoseconds>(high_resolution_clock::now() - start).count() / (double)calls;
+}
+
+string formatRate(double perSecond) {
+    ostringstream text;
+    text << fixed << setprecision(1);
+    if (perSecond >= 1e9) {
+        text << perSecond / 1e9 << " G";
+    } else if (perSecond >= 1e6) {
+        text << perSecond / 1e6 << " M";
+    } else if (perSecond >= 1e3) {
+        text << perSecond / 1e3 << " K";
+    } else {
+        text << perSecond << " ";
+    }
+    return text.str();
+}
+
+// First digits of a big value, from its logarithm in long double (no decimal
+// conversion); count <= 12 keeps them exact for numbers with millions of digits
+string leadingDigits(const BigInteger& value, int count) {
+    if (value.decimalDigits() <= (uint64_t)count) return value.toString();
+    const BigInteger::Limbs& limbs = value.data();
+    size_t n = limbs.size();
+    long double top = 0;
+    for (size_t i = n; i-- > 0 && i + 3 >= n; ) top = top * 4294967296.0L + limbs[i];
+    size_t shifted = n >= 3 ? n - 3 : 0;
+    long double logarithm = log10l(top) + (long double)shifted * 32 * log10l(2.0L);
+    long double mantissa = powl(10.0L, logarithm - floorl(logarithm) + count - 1);
+    return to_string((long long)mantissa);
+}
+
+// Fibonacci engines on growing n: time, digits per second, agreement
+void runFibonacciBenchmark(uint64_t maxN) {
+    const uint64_t modulus = 1000000007;
+    const double iterativeBudgetMs = 5000;
+    cout << "Fibonacci engines (time per F(n))\n" << endl;
+    cout << setw(10) << "n" << setw(10) << "Digits" << setw(14) << "int iter" << setw(14) << "Big iter"
+         << setw(14) << "Fast doubl." << setw(12) << "Digits/s" << setw(12) << "mod 1e9+7" << endl;
+    cout << string(86, '-') << endl;
+
+    bool runIterative = true;
+    const uint64_t sizes[] = {10, 46, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+    for (uint64_t n : sizes) {
+        if (n > maxN) break;
+        bool correct = true;
+
+        auto start = high_resolution_clock::now();
+        BigInteger fast = fibonacciFastDoubling(n);
+        double fastMs = elapsedMs(start);
+        if (fastMs < 10) fastMs = averageNs([n]() { fibonacciFastDoubling(n); }) / 1e6;
+        uint64_t digits = fast.decimalDigits();
+
+        string intColumn = "overflow";
+        if (n <= (uint64_t)FIBONACCI_INT_MAX_N) {
+            volatile int sink = 0;
+            double ns = averageNs([n, &sink]() { sink = fibonacciIterative((int)n); });
+            if (BigInteger((uint64_t)fibonacciIterative((int)n)) != fast) correct = false;
+            ostringstream text;
+            text << fixed << setprecision(1) << ns << " ns";
+            intColumn = text.str();
+        }
+
+        string iterativeColumn = "-";
+        if (runIterative) {
+            start = high_resolution_clock::now();
+            BigInteger iterative = fibonacciIterativeBig(n);
+            double iterativeMs = elapsedMs(start);
+            if (iterative != fast) correct = false;
+            runIterative = iterativeMs * 100 < iterativeBudgetMs;   // next n is 10x, O(n^2)
+            ostringstream text;
+            text << fixed << setprecision(3) << iterativeMs << " ms";
+            iterativeColumn = text.str();
+        }
+
+        uint64_t residue = fibonacciMod(n, modulus);
+        if (residue != fast.modSmall((uint32_t)modulus) ||
+            fibonacciMod(n, 4294967291ULL) != fast.modSmall(4294967291U)) {
+            correct = false;
+        }
+        double modNs = averageNs([n]() { fibonacciMod(n, modulus); });
+
+        ostringstream fastColumn;
+        fastColumn << fixed << setprecision(3) << fastMs << " ms";
+        ostringstream modColumn;
+        modColumn << fixed << setprecision(0) << modNs << " ns";
+        cout << setw(10) << n << setw(10) << digits << setw(14) << intColumn << setw(14) << iterativeColumn
+             << setw(14) << fastColumn.str() << setw(12) << formatRate(digits / (fastMs / 1000))
+             << setw(12) << modColumn.str() << (correct ? "" : "  (results differ!)") << endl;
+    }
+
+    cout << "\nint iter: fibonacciIterative on int, wrong (silent overflow) past F(" << FIBONACCI_INT_MAX_N << ")" << endl;
+    cout << "Big iter: n - 1 big additions, O(n^2); stopped when the next n would exceed "
+         << iterativeBudgetMs / 1000 << " s" << endl;
+    cout << "Fast doubl.: fast doubling with Karatsuba above " << KARATSUBA_THRESHOLD << " limbs, NTT above "
+         << NTT_THRESHOLD << " limbs" << endl;
+}
+
+// F(n): digit count, time, first and last digits (or every digit)
+void runFibonacci(uint64_t n, bool printAll) {
+    auto start = high_resolution_clock::now();
+    BigInteger value = fibonacciFastDoubling(n);
+    double ms = elapsedMs(start);
+    uint64_t digits = value.decimalDigits();
+
+    cout << "F(" << n << ") has " << digits << " digits, computed in " << fixed << setprecision(3) << ms
+         << " ms (" << formatRate(digits / max(ms / 1000, 1e-9)) << "digits/s)" << endl;
+    if (printAll) {
+        cout << value.toString() << endl;
+    } else if (digits <= 40) {
+        cout << "F(" << n << ") = " << value.toString() << endl;
+    } else {
+        // Last digits come from the modular engine, no decimal conversion needed
+        string last = to_string(fibonacciMod(n, 1000000000000000000ULL));
+        last = string(18 - last.size(), '0') + last;
+        cout << "F(" << n << ") = " << leadingDigits(value, 12) << "..." << last << endl;
+    }
+}
+
+string formatMs(double ms) {
+    ostringstream text;
+    text << fixed << setprecision(ms < 10 ? 3 : 1) << ms << " ms";
+    return text.str();
+}
+
+// Factorial engines on growing n, single- and multi-threaded
+void runFactorialBenchmark(uint32_t maxN, int threads) {
+    const double sequentialBudgetMs = 5000;
+    cout << "Factorial engines (time per n!, " << threads << " threads for the xT columns)\n" << endl;
+    cout << setw(10) << "n" << setw(10) << "Digits" << setw(13) << "Sequential" << setw(13) << "Split"
+         << setw(13) << "Split xT" << setw(13) << "Swing" << setw(13) << "Swing xT" << setw(12) << "Digits/s" << endl;
+    cout << string(97, '-') << endl;
+
+    bool runSequential = true;
+    const uint32_t sizes[] = {10000, 30000, 100000, 300000, 1000000, 3000000, 10000000};
+    for (uint32_t n : sizes) {
+        if (n > maxN) break;
+        bool correct = true;
+
+        auto start = high_resolution_clock::now();
+        BigInteger swing = factorialPrimeSwing(n, 1);
+        double swingMs = elapsedMs(start);
+
+        start = high_resolution_clock::now();
+        BigInteger swingThreads = factorialPrimeSwing(n, threads);
+        double swingThreadsMs = elapsedMs(start);
+        if (swingThreads != swing) correct = false;
+
+        start = high_resolution_clock::now();
+        BigInteger split = factorialBinarySplit(n, 1);
+        double splitMs = elapsedMs(start);
+        if (split != swing) correct = false;
+        split = BigInteger();
+
+        start = high_resolution_clock::now();
+        BigInteger splitThreads = factorialBinarySplit(n, threads);
+        double splitThreadsMs = elapsedMs(start);
+        if (splitThreads != swing) correct = false;
+        splitThreads = BigInteger();
+
+        string sequentialColumn = "-";
+        if (runSequential) {
+            start = high_resolution_clock::now();
+            BigInteger sequential = factorialSequential(n);
+            double sequentialMs = elapsedMs(start);
+            if (sequential != swing) correct = false;
+            runSequential = sequentialMs * 10 < sequentialBudgetMs;   // next n is ~3x, O(n^2)
+            sequentialColumn = formatMs(sequentialMs);
+        }
+
+        uint64_t digits = swing.decimalDigits();
+        double bestMs = min(min(splitMs, splitThreadsMs), min(swingMs, swingThreadsMs));
+        cout << setw(10) << n << setw(10) << digits << setw(13) << sequentialColumn << setw(13) << formatMs(splitMs)
+             << setw(13) << formatMs(splitThreadsMs) << setw(13) << formatMs(swingMs)
+             << setw(13) << formatMs(swingThreadsMs) << setw(12) << formatRate(digits / max(bestMs / 1000, 1e-9))
+             << (correct ? "" : "  (results differ!)") << endl;
+    }
+
+    cout << "\nSequential: n - 1 big-by-small products, O(n^2); stopped when the next n would exceed "
+         << sequentialBudgetMs / 1000 << " s" << endl;
+    cout << "Split: product tree of the odd parts of 2..n, one shift for the powers of two" << endl;
+    cout << "Swing: n! = (n/2)!^2 * swing(n), prime factors only" << endl;
+    cout << "Multiplication: Karatsuba from " << KARATSUBA_THRESHOLD << " limbs, NTT from " << NTT_THRESHOLD
+         << " limbs; Digits/s uses the fastest engine" << endl;
+}
+
+// n!: digit count, time, first digits and trailing zeros (or every digit)
+void runFactorial(uint32_t n, int threads, bool printAll) {
+    auto start = high_resolution_clock::now();
+    BigInteger value = factorialPrimeSwing(n, threads);
+    double ms = elapsedMs(start);
+    uint64_t digits = value.decimalDigits();
+
+    uint64_t zeros = 0;
+    for (uint64_t power = 5; power <= n; power *= 5) zeros += n / power;
+
+    cout << n << "! has " << digits << " digits (" << zeros << " trailing zeros), computed in " << fixed
+         << setprecision(3) << ms << " ms on " << threads << " threads" << endl;
+    if (printAll) {
+        cout << value.toString() << endl;
+    } else if (digits <= 40) {
+        cout << n << "! = " << value.toString() << endl;
+    } else {
+        cout << n << "! = " << leadingDigits(value, 12) << "..." << endl;
+    }
+}
+
+// C(n, r) mod p without tables: r products and one modular inverse, O(r + log p)
+uint32_t binomialDirect(uint32_t n, uint32_t r, uint32_t p) {
+    if (r > n) return 0;
+    r = min(r, n - r);
+    uint64_t numerator = 1, denominator = 1;
+    for (uint32_t i = 1; i <= r; i++) {
+        numerator = numerator * (n - r + i) % p;
+        denominator = denominator * i % p;
+    }
+    uint64_t inverse = 1, base = denominator;
+    for (uint32_t exponent = p - 2; exponent != 0; exponent >>= 1) {
+        if (exponent & 1) inverse = inverse * base % p;
+        base = base * base % p;
+    }
+    return (uint32_t)(numerator * inverse % p);
+}
+
+// Random queries n <= maxN, r <= n
+void generateBinomialQueries(uint32_t maxN, size_t count, vector<uint32_t>& n, vector<uint32_t>& r) {
+    mt19937 gen(inputSeed + maxN);
+    n.resize(count);
+    r.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        n[i] = (uint32_t)(gen() % ((uint64_t)maxN + 1));
+        r[i] = (uint32_t)(gen() % ((uint64_t)n[i] + 1));
+    }
+}
+
+uint32_t xorReduce(const vector<uint32_t>& values) {
+    uint32_t sum = 0;
+    for (uint32_t value : values) sum ^= value;
+    return sum;
+}
+
+void printQueryRate(const string& name, double ms, size_t queries, bool correct) {
+    double ns = ms * 1e6 / (double)queries;
+    cout << "  " << left << setw(30) << name << right << fixed << setprecision(1) << setw(9) << ns << " ns"
+         << setw(14) << formatRate(1e9 / ns) + "q/s" << (correct ? "" : "  (results differ!)") << endl;
+}
+
+// Factorial tables mod p: build time, query engines, save and mapped reload
+void runTableBenchmark(uint32_t maxN, size_t queries, const string& path) {
+    FactorialTable table;
+    auto start = high_resolution_clock::now();
+    if (!table.build(maxN, TABLE_DEFAULT_MODULUS)) {
+        cout << "Error: " << table.lastError() << endl;
+        return;
+    }
+    double buildMs = elapsedMs(start);
+    uint32_t p = table.modulus();
+    cout << "Factorial tables mod " << p << " up to n = " << maxN << ": " << fixed << setprecision(1)
+         << table.memoryBytes() / 1048576.0 << " MB, built in " << setprecision(3) << buildMs << " ms ("
+         << setprecision(2) << buildMs * 1e6 / ((double)maxN + 1) << " ns per entry)\n" << endl;
+
+    vector<uint32_t> n, r, results(queries);
+    generateBinomialQueries(maxN, queries, n, r);
+    cout << "C(n, r) mod p, " << queries << " random queries (n <= " << maxN << ")" << endl;
+
+    // Without tables: a few queries are enough, each costs O(r)
+    size_t directQueries = min(queries, (size_t)200);
+    bool directCorrect = true;
+    start = high_resolution_clock::now();
+    for (size_t i = 0; i < directQueries; i++) results[i] = binomialDirect(n[i], r[i], p);
+    double directMs = elapsedMs(start);
+    for (size_t i = 0; i < directQueries; i++) {
+        if (results[i] != table.binomial(n[i], r[i])) directCorrect = false;
+    }
+    printQueryRate("Direct, O(r) per query", directMs, directQueries, directCorrect);
+
+    // Same tables in plain form, reduced with % (a 64-bit division by a run-time modulus)
+    vector<uint32_t> factorials(maxN + 1), inverses(maxN + 1);
+    for (uint32_t k = 0; k <= maxN; k++) {
+        factorials[k] = table.factorial(k);
+        inverses[k] = table.inverseFactorial(k);
+    }
+    start = high_resolution_clock::now();
+    for (size_t i = 0; i < queries; i++) {
+        results[i] = (uint32_t)((uint64_t)factorials[n[i]] * inverses[r[i]] % p * inverses[n[i] - r[i]] % p);
+    }
+    double plainMs = elapsedMs(start);
+    uint32_t expected = xorReduce(results);
+    printQueryRate("Table, % reduction", plainMs, queries, true);
+    vector<uint32_t>().swap(factorials);
+    vector<uint32_t>().swap(inverses);
+
+    start = high_resolution_clock::now();
+    for (size_t i = 0; i < queries; i++) results[i] = table.binomial(n[i], r[i]);
+    double montgomeryMs = elapsedMs(start);
+    printQueryRate("Table, Montgomery", montgomeryMs, queries, xorReduce(results) == expected);
+
+    start = high_resolution_clock::now();
+    table.binomialBatch(n.data(), r.data(), results.data(), queries);
+    double batchMs = elapsedMs(start);
+    printQueryRate("Table, Montgomery, batched", batchMs, queries, xorReduce(results) == expected);
+
+    start = high_resolution_clock::now();
+    table.permutationsBatch(n.data(), r.data(), results.data(), queries);
+    double permutationsMs = elapsedMs(start);
+    bool permutationsCorrect = true;
+    for (size_t i = 0; i < queries; i += 997) {
+        if (results[i] != table.permutations(n[i], r[i])) permutationsCorrect = false;
+    }
+    printQueryRate("P(n, r), batched", permutationsMs, queries, permutationsCorrect);
+
+    if (path.empty()) return;
+
+    cout << "\nSaved tables (" << path << ")" << endl;
+    start = high_resolution_clock::now();
+    if (!table.save(path)) {
+        cout << "Error: " << table.lastError() << endl;
+        return;
+    }
+    cout << "  Save:                " << fixed << setprecision(3) << elapsedMs(start) << " ms" << endl;
+
+    FactorialTable loaded;
+    start = high_resolution_clock::now();
+    if (!loaded.load(path)) {
+        cout << "Error: " << loaded.lastError() << endl;
+        return;
+    }
+    cout << "  Load (" << (loaded.isMapped() ? "mmap" : "read") << "):         " << elapsedMs(start)
+         << " ms, instead of a " << buildMs << " ms rebuild" << endl;
+
+    size_t firstQueries = min(queries, (size_t)100000);
+    start = high_resolution_clock::now();
+    loaded.binomialBatch(n.data(), r.data(), results.data(), firstQueries);
+    double firstMs = elapsedMs(start);
+    bool loadedCorrect = true;
+    for (size_t i = 0; i < firstQueries; i++) {
+        if (results[i] != table.binomial(n[i], r[i])) loadedCorrect = false;
+    }
+    printQueryRate("First queries after load", firstMs, firstQueries, loadedCorrect);
+}
+
+void printUsage(const char* program) {
+    cout << "Usage:" << endl;
+    cout << "  " << program << " [maxN]" << endl;
+    cout << "      Fibonacci benchmark: int, big iterative, fast doubling, mod m (default maxN: 10000000)" << endl;
+    cout << "  " << program << " --fib <n> [--print]" << endl;
+    cout << "      Exact F(n) by fast doubling (--print writes every digit)" << endl;
+    cout << "  " << program << " --fib-mod <n> <m>" << endl;
+    cout << "      F(n) mod m for any 64-bit n and m" << endl;
+    cout << "  " << program << " --factorial [maxN] [threads]" << endl;
+    cout << "      Factorial benchmark: sequential, binary splitting, prime swing (default maxN: 1000000)" << endl;
+    cout << "  " << program << " --fact <n> [threads] [--print]" << endl;
+    cout << "      Exact n! by the prime swing (--print writes every digit)" << endl;
+    cout << "  " << program << " --ncr [maxN] [queries] [table file]" << endl;
+    cout << "      C(n, r) mod 1e9+7 from factorial tables (default maxN: 10000000, queries: 10000000);" << endl;
+    cout << "      with a file, also saves the tables and maps them back" << endl;
+    cout << "  " << program << " --ncr-save <table file> <maxN> [prime]" << endl;
+    cout << "      Build factorial tables mod prime (default 1e9+7) and save them" << endl;
+    cout << "  " << program << " --ncr-query <table file> <n> <r>" << endl;
+    cout << "      Map saved tables and answer C(n, r) and P(n, r)" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    cout << "========================================" << endl;
+    cout << "Big Number Algorithms Tool" << endl;
+    cout << "========================================\n" << endl;
+
+    string mode = (argc > 1) ? argv[1] : "";
+    if (mode == "--fib" && argc > 2) {
+        bool printAll = argc > 3 && string(argv[3]) == "--print";
+        runFibonacci(strtoull(argv[2], nullptr, 10), printAll);
+        return 0;
+    }
+    if (mode == "--fib-mod" && argc > 3) {
+        uint64_t n = strtoull(argv[2], nullptr, 10);
+        uint64_t m = strtoull(argv[3], nullptr, 10);
+        if (m == 0) {
+            cout << "Error: m must be at least 1" << endl;
+            return 1;
+        }
+        auto start = high_resolution_clock::now();
+        uint64_t residue = fibonacciMod(n, m);
+        cout << "F(" << n << ") mod " << m << " = " << residue << "  (" << fixed << setprecision(3)
+             << elapsedMs(start) << " ms)" << endl;
+        return 0;
+    }
+    int hardwareThreads = max(1, (int)thread::hardware_concurrency());
+    if (mode == "--factorial") {
+        uint32_t maxN = (argc > 2) ? (uint32_t)strtoul(argv[2], nullptr, 10) : 1000000;
+        int threads = (argc > 3) ? max(1, atoi(argv[3])) : hardwareThreads;
+        runFactorialBenchmark(maxN, threads);
+        return 0;
+    }
+    if (mode == "--fact" && argc > 2) {
+        bool printAll = string(argv[argc - 1]) == "--print";
+        int threads = (argc > 3 && string(argv[3]) != "--print") ? max(1, atoi(argv[3])) : hardwareThreads;
+        runFactorial((uint32_t)strtoul(argv[2], nullptr, 10), threads, printAll);
+        return 0;
+    }
+    if (mode == "--ncr") {
+        uint32_t maxN = (argc > 2) ? (uint32_t)strtoul(argv[2], nullptr, 10) : 10000000;
+        size_t queries = (argc > 3) ? (size_t)max(1LL, atoll(argv[3])) : 10000000;
+        runTableBenchmark(maxN, queries, (argc > 4) ? argv[4] : "");
+        return 0;
+    }
+    if (mode == "--ncr-save" && argc > 3) {
+        uint32_t modulus = (argc > 4) ? (uint32_t)strtoul(argv[4], nullptr, 10) : TABLE_DEFAULT_MODULUS;
+        FactorialTable table;
+        auto start = high_resolution_clock::now();
+        if (!table.build((uint32_t)strtoul(argv[3], nullptr, 10), modulus) || !table.save(argv[2])) {
+            cout << "Error: " << table.lastError() << endl;
+            return 1;
+        }
+        cout << "Saved factorial tables mod " << table.modulus() << " up to n = " << table.maxN() << " to "
+             << argv[2] << " (" << fixed << setprecision(1) << table.memoryBytes() / 1048576.0 << " MB, "
+             << setprecision(3) << elapsedMs(start) << " ms)" << endl;
+        return 0;
+    }
+    if (mode == "--ncr-query" && argc > 4) {
+        FactorialTable table;
+        auto start = high_resolution_clock::now();
+        if (!table.load(argv[2])) {
+            cout << "Error: " << table.lastError() << endl;
+            return 1;
+        }
+        double loadMs = elapsedMs(start);
+        uint32_t n = (uint32_t)strtoul(argv[3], nullptr, 10);
+        uint32_t r = (uint32_t)strtoul(argv[4], nullptr, 10);
+        if (n > table.maxN()) {
+            cout << "Error: n must be at most " << table.maxN() << " for these tables" << endl;
+            return 1;
+        }
+        cout << "Tables mod " << table.modulus() << " up to n = " << table.maxN() << " loaded in " << fixed
+             << setprecision(3) << loadMs << " ms" << endl;
+        cout << "C(" << n << ", " << r << ") mod " << table.modulus() << " = " << table.binomial(n, r) << endl;
+        cout << "P(" << n << ", " << r << ") mod " << table.modulus() << " = " << table.permutations(n, r) << endl;
+        return 0;
+    }
+    if (argc > 1 && argv[1][0] == '-') {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    uint64_t maxN = (argc > 1) ? strtoull(argv[1], nullptr, 10) : 10000000;
+    runFibonacciBenchmark(maxN);
+    return 0;
+}
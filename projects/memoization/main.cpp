@@ -0,0 +1,218 @@
+/*
+ * Memoization Tool
+ *
+ * A bounded, thread-safe memoization cache (memo_cache.h) applied to the
+ * naive recursive Fibonacci and to the top-down 0/1 knapsack: calls, time,
+ * hit rate and memory against the plain recursion and the DP table, with
+ * cache sizes below the number of subproblems and with several threads
+ * sharing one cache.
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <sstream>
+#include <memory>
+#include "memo_cache.h"
+using namespace std;
+using namespace std::chrono;
+
+unsigned int inputSeed = 42;
+
+// Recursive Fibonacci (from assignments/recursion/fibonacci.cpp), O(2^n)
+int fibonacciRecursive(int n) {
+    // Base cases
+    if (n <= 1) {
+        return n;
+    }
+
+    // Recursive case
+    return fibonacciRecursive(n - 1) + fibonacciRecursive(n - 2);
+}
+
+// Space-optimized knapsack (from assignments/dynamic_programming/knapsack.cpp),
+// returning the best value for every capacity up to W
+vector<int> knapsackTable(int W, const vector<int>& weights, const vector<int>& values) {
+    vector<int> dp(W + 1, 0);
+    for (size_t i = 0; i < weights.size(); i++) {
+        for (int w = W; w >= weights[i]; w--) {
+            dp[w] = max(dp[w], values[i] + dp[w - weights[i]]);
+        }
+    }
+    return dp;
+}
+
+typedef Memoized<long long(int)> MemoFibonacci;
+typedef Memoized<int(int, int)> MemoKnapsack;
+
+MemoFibonacci* makeMemoFibonacci(size_t capacity) {
+    return new MemoFibonacci([](MemoFibonacci& self, int n) -> long long {
+        if (n <= 1) return n;
+        return self(n - 1) + self(n - 2);
+    }, capacity);
+}
+
+// best(i, w): best value from items i.. with capacity w (the recursion of
+// knapsackMemo in assignments/dynamic_programming/knapsack.cpp)
+MemoKnapsack* makeMemoKnapsack(const vector<int>& weights, const vector<int>& values, size_t capacity,
+                               size_t shards = MEMO_DEFAULT_SHARDS) {
+    return new MemoKnapsack([&weights, &values](MemoKnapsack& self, int i, int w) -> int {
+        if (i == (int)weights.size()) return 0;
+        int best = self(i + 1, w);
+        if (weights[i] <= w) best = max(best, values[i] + self(i + 1, w - weights[i]));
+        return best;
+    }, capacity, shards);
+}
+
+double elapsedMs(high_resolution_clock::time_point start) {
+    return duration_cast<microseconds>(high_resolution_clock::now() - start).count() / 1000.0;
+}
+
+string formatBytes(long long bytes) {
+    ostringstream text;
+    text << fixed << setprecision(1);
+    if (bytes >= 1048576) {
+        text << bytes / 1048576.0 << " MB";
+    } else {
+        text << bytes / 1024.0 << " KB";
+    }
+    return text.str();
+}
+
+void printStatsRow(const string& label, double ms, const MemoStats& stats, bool correct) {
+    cout << setw(14) << label << setw(12) << fixed << setprecision(3) << ms << setw(12) << stats.misses
+         << setw(10) << setprecision(1) << stats.hitRate() * 100 << "%" << setw(11) << stats.evictions
+         << setw(11) << formatBytes(stats.memoryBytes) << (correct ? "" : "  (wrong result!)") << endl;
+}
+
+void printStatsHeader(const string& first) {
+    cout << setw(14) << first << setw(12) << "Time (ms)" << setw(12) << "Calls" << setw(11) << "Hit rate"
+         << setw(11) << "Evictions" << setw(11) << "Memory" << endl;
+    cout << string(71, '-') << endl;
+}
+
+void runFibonacciDemo() {
+    cout << "Fibonacci: naive recursion vs memoized (capacity 1024)\n" << endl;
+    cout << setw(6) << "n" << setw(14) << "Naive (ms)" << setw(16) << "Naive calls" << setw(14) << "Memo (ms)"
+         << setw(12) << "Memo calls" << setw(11) << "Hit rate" << endl;
+    cout << string(73, '-') << endl;
+    for (int n : {20, 25, 30, 35, 40}) {
+        auto start = high_resolution_clock::now();
+        int naive = fibonacciRecursive(n);
+        double naiveMs = elapsedMs(start);
+
+        unique_ptr<MemoFibonacci> fibonacci(makeMemoFibonacci(1024));
+        start = high_resolution_clock::now();
+        long long memo = (*fibonacci)(n);
+        double memoMs = elapsedMs(start);
+        MemoStats stats = fibonacci->stats();
+
+        // The naive recursion makes 2 F(n + 1) - 1 calls
+        long long naiveCalls = 2LL * (*fibonacci)(n + 1) - 1;
+        cout << setw(6) << n << setw(14) << fixed << setprecision(3) << naiveMs << setw(16) << naiveCalls
+             << setw(14) << memoMs << setw(12) << stats.misses << setw(10) << setprecision(1)
+             << stats.hitRate() * 100 << "%" << (memo == naive ? "" : "  (wrong result!)") << endl;
+    }
+
+    // Far past what the naive recursion can reach, and with a cache smaller than n
+    cout << "\nF(90) = 2880067194370816120 with bounded caches\n" << endl;
+    printStatsHeader("Capacity");
+    for (size_t capacity : {1024, 16, 4}) {
+        unique_ptr<MemoFibonacci> fibonacci(makeMemoFibonacci(capacity));
+        auto start = high_resolution_clock::now();
+        long long value = (*fibonacci)(90);
+        double ms = elapsedMs(start);
+        printStatsRow(to_string(capacity), ms, fibonacci->stats(), value == 2880067194370816120LL);
+    }
+}
+
+void runKnapsackDemo(int items, int W) {
+    mt19937 gen(inputSeed);
+    vector<int> weights(items), values(items);
+    for (int i = 0; i < items; i++) {
+        weights[i] = 1 + (int)(gen() % 100);
+        values[i] = 1 + (int)(gen() % 1000);
+    }
+    vector<int> expected = knapsackTable(W, weights, values);
+    long long states = (long long)(items + 1) * (W + 1);
+
+    cout << "\nKnapsack: " << items << " items, capacity " << W << ", " << states << " subproblems (i, w)\n"
+         << endl;
+    auto start = high_resolution_clock::now();
+    knapsackTable(W, weights, values);
+    cout << "DP table (bottom-up): " << fixed << setprecision(3) << elapsedMs(start) << " ms\n" << endl;
+
+    // Memoized recursion, cache from all subproblems down to a fraction of them
+    printStatsHeader("Capacity");
+    for (int percent : {100, 50, 40}) {
+        size_t capacity = (size_t)(states * percent / 100);
+        unique_ptr<MemoKnapsack> knapsack(makeMemoKnapsack(weights, values, capacity));
+        start = high_resolution_clock::now();
+        int best = (*knapsack)(0, W);
+        double ms = elapsedMs(start);
+        printStatsRow(to_string(percent) + "% states", ms, knapsack->stats(), best == expected[W]);
+    }
+
+    // Threads answering queries for many capacities w <= W on one shared cache
+    int maxThreads = max(4, (int)thread::hardware_concurrency());
+    const int queries = 256;
+    vector<int> queryCapacity(queries);
+    for (int q = 0; q < queries; q++) queryCapacity[q] = W / 2 + (int)(gen() % (W / 2 + 1));
+
+    cout << "\n" << queries << " queries best(0, w), w in [" << W / 2 << ", " << W
+         << "], threads sharing one cache (capacity = all subproblems)\n" << endl;
+    cout << setw(9) << "Threads" << setw(9) << "Shards" << setw(12) << "Time (ms)" << setw(12) << "Calls"
+         << setw(11) << "Hit rate" << setw(11) << "Memory" << endl;
+    cout << string(64, '-') << endl;
+    for (size_t shards : {(size_t)1, MEMO_DEFAULT_SHARDS}) {
+        for (int threads = 1; threads <= maxThreads; threads *= 2) {
+            unique_ptr<MemoKnapsack> knapsack(makeMemoKnapsack(weights, values, (size_t)states, shards));
+            vector<int> answers(queries);
+            start = high_resolution_clock::now();
+            vector<thread> workers;
+            for (int t = 0; t < threads; t++) {
+                workers.push_back(thread([&, t]() {
+                    for (int q = t; q < queries; q += threads) answers[q] = (*knapsack)(0, queryCapacity[q]);
+                }));
+            }
+            for (thread& worker : workers) worker.join();
+            double ms = elapsedMs(start);
+
+            bool correct = true;
+            for (int q = 0; q < queries; q++) {
+                if (answers[q] != expected[queryCapacity[q]]) correct = false;
+            }
+            MemoStats stats = knapsack->stats();
+            cout << setw(9) << threads << setw(9) << shards << setw(12) << fixed << setprecision(3) << ms
+                 << setw(12) << stats.misses << setw(10) << setprecision(1) << stats.hitRate() * 100 << "%"
+                 << setw(11) << formatBytes(stats.memoryBytes) << (correct ? "" : "  (wrong result!)") << endl;
+        }
+    }
+
+    cout << "\nCalls: evaluations of the function body (cache misses)" << endl;
+    cout << "Memory: estimated heap of the cache slots and hash index" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    cout << "========================================" << endl;
+    cout << "Memoization Tool" << endl;
+    cout << "========================================\n" << endl;
+
+    if (argc > 1 && argv[1][0] == '-') {
+        cout << "Usage: " << argv[0] << " [items] [capacity]" << endl;
+        cout << "  Memoized Fibonacci and knapsack (default: 100 items, capacity 5000)" << endl;
+        return 1;
+    }
+    int items = (argc > 1) ? max(1, atoi(argv[1])) : 100;
+    int W = (argc > 2) ? max(2, atoi(argv[2])) : 5000;
+
+    runFibonacciDemo();
+    runKnapsackDemo(items, W);
+    return 0;
+}
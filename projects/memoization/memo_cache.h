@@ -0,0 +1,267 @@
+/*
+ * Bounded, Thread-Safe Memoization Cache
+ *
+ * MemoCache<Key, Value> maps argument tuples to results with a fixed
+ * maximum number of entries. It is split into shards (a power of two),
+ * each with its own mutex, hash index and slot array; the hash of a key
+ * picks the shard, so threads working on different keys rarely wait for
+ * the same lock.
+ *
+ * Eviction is CLOCK (second chance): every slot has a referenced bit that
+ * a hit sets; to make room, a hand sweeps the slots, clears set bits and
+ * evicts the first slot whose bit was already clear. It approximates LRU,
+ * but a hit only sets a bit instead of moving a list node, so the time
+ * spent under the shard lock stays short.
+ *
+ * Memoized<Result(Args...)> wraps a pure recursive function. The body
+ * receives the wrapper as its first parameter and recurses through it:
+ *
+ *     Memoized<long long(int)> fib([](Memoized<long long(int)>& self, int n) -> long long {
+ *         return n <= 1 ? n : self(n - 1) + self(n - 2);
+ *     }, 1024);
+ *     fib(90);
+ *
+ * No lock is held while the body runs (it recurses into the cache), so two
+ * threads missing the same key at the same time both compute it; the
+ * function is pure, so the second insert only refreshes the entry.
+ *
+ * Costs: a lookup or insert is O(1) expected under one shard lock.
+ * stats().memoryBytes is an estimate of the heap used by the slots and the hash
+ * index (node and bucket overhead of std::unordered_map included).
+ */
+
+#ifndef MEMO_CACHE_H
+#define MEMO_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Shards of a cache unless told otherwise
+const size_t MEMO_DEFAULT_SHARDS = 16;
+
+// Fewer shards for small caches, so that every shard keeps at least this many
+// entries (a recursion evicting its own recent results recomputes exponentially)
+const size_t MEMO_MIN_SHARD_ENTRIES = 64;
+
+// 64-bit finalizer (splitmix64): spreads small, regular keys over all bits
+inline uint64_t memoMix(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Hash of a std::tuple: polynomial in std::hash of the elements with a large
+// odd multiplier. Arguments differing by a little in the last element land
+// in nearby buckets, which keeps the index cache-friendly for recursions
+// that walk neighbouring arguments; the shard is picked from a mixed hash.
+template <typename Tuple, size_t Count = std::tuple_size<Tuple>::value>
+struct TupleHashCombine {
+    static uint64_t combine(const Tuple& tuple) {
+        typedef typename std::tuple_element<Count - 1, Tuple>::type Element;
+        uint64_t seed = TupleHashCombine<Tuple, Count - 1>::combine(tuple);
+        uint64_t element = (uint64_t)std::hash<Element>()(std::get<Count - 1>(tuple));
+        return seed * 0x9E3779B97F4A7C15ULL + element;
+    }
+};
+
+template <typename Tuple>
+struct TupleHashCombine<Tuple, 0> {
+    static uint64_t combine(const Tuple&) {
+        return 0;
+    }
+};
+
+template <typename Tuple>
+struct TupleHash {
+    size_t operator()(const Tuple& tuple) const {
+        return (size_t)TupleHashCombine<Tuple>::combine(tuple);
+    }
+};
+
+struct MemoStats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t capacity;
+    long long memoryBytes;
+
+    double hitRate() const {
+        return (hits + misses) ? (double)hits / (double)(hits + misses) : 0;
+    }
+};
+
+template <typename Key, typename Value, typename Hash = TupleHash<Key>>
+class MemoCache {
+public:
+    // capacity: maximum entries in total (at least one)
+    explicit MemoCache(size_t capacity, size_t shardCount = MEMO_DEFAULT_SHARDS) {
+        size_t shards = 1;
+        while (shards * 2 <= shardCount && shards * 2 * MEMO_MIN_SHARD_ENTRIES <= capacity) shards *= 2;
+        size_t perShard = (capacity + shards - 1) / shards;
+        for (size_t i = 0; i < shards; i++) {
+            this->shards.push_back(std::unique_ptr<Shard>(new Shard(perShard)));
+        }
+    }
+
+    MemoCache(const MemoCache&) = delete;
+    MemoCache& operator=(const MemoCache&) = delete;
+
+    size_t shardCount() const {
+        return shards.size();
+    }
+
+    // Copies the cached value of key into value; false on a miss
+    bool lookup(const Key& key, Value& value) {
+        Shard& shard = shardOf(key);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        typename Index::const_iterator found = shard.index.find(key);
+        if (found == shard.index.end()) {
+            shard.misses++;
+            return false;
+        }
+        Slot& slot = shard.slots[found->second];
+        slot.referenced = true;
+        value = slot.value;
+        shard.hits++;
+        return true;
+    }
+
+    // Stores key -> value, evicting by CLOCK when the shard is full
+    void insert(const Key& key, const Value& value) {
+        Shard& shard = shardOf(key);
+        std::lock_guard<std::mutex> guard(shard.lock);
+        typename Index::iterator found = shard.index.find(key);
+        if (found != shard.index.end()) {
+            shard.slots[found->second].value = value;
+            shard.slots[found->second].referenced = true;
+            return;
+        }
+
+        if (shard.slots.size() < shard.capacity) {
+            shard.index.emplace(key, shard.slots.size());
+            shard.slots.push_back(Slot{key, value, false});
+            return;
+        }
+
+        // Second chance: skip (and clear) referenced slots
+        while (shard.slots[shard.hand].referenced) {
+            shard.slots[shard.hand].referenced = false;
+            shard.hand = (shard.hand + 1) % shard.capacity;
+        }
+        Slot& victim = shard.slots[shard.hand];
+        shard.index.erase(victim.key);
+        victim.key = key;
+        victim.value = value;
+        shard.index.emplace(key, shard.hand);
+        shard.hand = (shard.hand + 1) % shard.capacity;
+        shard.evictions++;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < shards.size(); i++) {
+            Shard& shard = *shards[i];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            shard.index.clear();
+            shard.slots.clear();
+            shard.hand = 0;
+            shard.hits = shard.misses = shard.evictions = 0;
+        }
+    }
+
+    MemoStats stats() const {
+        MemoStats total = {0, 0, 0, 0, 0, 0};
+        for (size_t i = 0; i < shards.size(); i++) {
+            Shard& shard = *shards[i];
+            std::lock_guard<std::mutex> guard(shard.lock);
+            total.hits += shard.hits;
+            total.misses += shard.misses;
+            total.evictions += shard.evictions;
+            total.entries += shard.slots.size();
+            total.capacity += shard.capacity;
+            // Slots, map nodes (value + next pointer + cached hash) and buckets
+            total.memoryBytes += (long long)(shard.slots.capacity() * sizeof(Slot) +
+                                             shard.index.size() * (sizeof(typename Index::value_type) +
+                                                                   2 * sizeof(void*)) +
+                                             shard.index.bucket_count() * sizeof(void*));
+        }
+        return total;
+    }
+
+private:
+    struct Slot {
+        Key key;
+        Value value;
+        bool referenced;
+    };
+
+    typedef std::unordered_map<Key, size_t, Hash> Index;
+
+    // Allocated one by one, so the locks of neighbouring shards do not share a cache line
+    struct Shard {
+        explicit Shard(size_t slotCount)
+            : capacity(slotCount ? slotCount : 1), hand(0), hits(0), misses(0), evictions(0) {}
+
+        mutable std::mutex lock;
+        Index index;               // key -> slot
+        std::vector<Slot> slots;   // grows up to capacity, then recycled by the hand
+        size_t capacity;
+        size_t hand;
+        uint64_t hits, misses, evictions;
+    };
+
+    Shard& shardOf(const Key& key) {
+        // Runs of 64 neighbouring hashes share a shard (and its buckets); the runs
+        // are mixed over the shards
+        return *shards[memoMix(Hash()(key) >> 6) & (shards.size() - 1)];
+    }
+
+    std::vector<std::unique_ptr<Shard>> shards;
+};
+
+template <typename Signature>
+class Memoized;
+
+template <typename Result, typename... Args>
+class Memoized<Result(Args...)> {
+public:
+    typedef std::tuple<typename std::decay<Args>::type...> Key;
+    typedef std::function<Result(Memoized&, Args...)> Body;
+
+    Memoized(Body function, size_t capacity, size_t shardCount = MEMO_DEFAULT_SHARDS)
+        : body(std::move(function)), results(capacity, shardCount) {}
+
+    Result operator()(Args... args) {
+        Key key(args...);
+        Result result;
+        if (results.lookup(key, result)) return result;
+        result = body(*this, args...);
+        results.insert(key, result);
+        return result;
+    }
+
+    MemoStats stats() const {
+        return results.stats();
+    }
+
+    void clear() {
+        results.clear();
+    }
+
+private:
+    Body body;
+    MemoCache<Key, Result> results;
+};
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Branchless Binary Search
+ *
+ * lowerBound / upperBound / equalRange over a sorted int array with no
+ * data-dependent branch in the loop: every level halves the range and
+ * moves the base pointer with a conditional move, so the loop runs exactly
+ * ceil(log2(n)) times and never mispredicts.
+ *
+ * On large arrays every level is a cache miss. Since the next midpoint is
+ * one of two known addresses, both are prefetched before the current
+ * comparison resolves (Prefetch = true), which overlaps two levels.
+ *
+ * The batched versions search a group of independent queries in lockstep:
+ * all of them have the same range length at every level, so the loads of
+ * one level are issued back to back and their memory stalls overlap.
+ */
+
+#ifndef BRANCHLESS_SEARCH_H
+#define BRANCHLESS_SEARCH_H
+
+#include <algorithm>
+#include <utility>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SEARCH_PREFETCH(address) __builtin_prefetch(address)
+#else
+#define SEARCH_PREFETCH(address) ((void)(address))
+#endif
+
+// Queries searched together by the batched functions
+const int SEARCH_BATCH_SIZE = 16;
+
+// Index of the first element >= target (Upper = false) or > target (Upper = true)
+template <bool Upper, bool Prefetch>
+inline int boundBranchless(const int* data, int n, int target) {
+    if (n == 0) return 0;
+    const int* base = data;
+    int length = n;
+    while (length > 1) {
+        int half = length / 2;
+        if (Prefetch) {
+            int nextHalf = (length - half) / 2;
+            SEARCH_PREFETCH(base + nextHalf);
+            SEARCH_PREFETCH(base + half + nextHalf);
+        }
+        bool right = Upper ? (base[half] <= target) : (base[half] < target);
+        base = right ? base + half : base;
+        length -= half;
+    }
+    bool after = Upper ? (*base <= target) : (*base < target);
+    return (int)(base - data) + after;
+}
+
+// First index with data[i] >= target (n if none)
+inline int lowerBoundBranchless(const int* data, int n, int target) {
+    return boundBranchless<false, true>(data, n, target);
+}
+
+// First index with data[i] > target (n if none)
+inline int upperBoundBranchless(const int* data, int n, int target) {
+    return boundBranchless<true, true>(data, n, target);
+}
+
+// [lowerBound, upperBound): the positions equal to target
+inline std::pair<int, int> equalRangeBranchless(const int* data, int n, int target) {
+    return std::make_pair(lowerBoundBranchless(data, n, target), upperBoundBranchless(data, n, target));
+}
+
+// results[i] = bound of queries[i], SEARCH_BATCH_SIZE queries in lockstep
+template <bool Upper>
+inline void boundBatch(const int* data, int n, const int* queries, int count, int* results) {
+    const int* base[SEARCH_BATCH_SIZE];
+    for (int start = 0; start < count; start += SEARCH_BATCH_SIZE) {
+        int group = std::min(SEARCH_BATCH_SIZE, count - start);
+        const int* q = queries + start;
+        if (n == 0) {
+            std::fill(results + start, results + start + group, 0);
+            continue;
+        }
+
+        for (int g = 0; g < group; g++) base[g] = data;
+        int length = n;
+        while (length > 1) {
+            int half = length / 2;
+            for (int g = 0; g < group; g++) {
+                bool right = Upper ? (base[g][half] <= q[g]) : (base[g][half] < q[g]);
+                base[g] = right ? base[g] + half : base[g];
+            }
+            length -= half;
+        }
+        for (int g = 0; g < group; g++) {
+            bool after = Upper ? (*base[g] <= q[g]) : (*base[g] < q[g]);
+            results[start + g] = (int)(base[g] - data) + after;
+        }
+    }
+}
+
+inline void lowerBoundBatch(const int* data, int n, const int* queries, int count, int* results) {
+    boundBatch<false>(data, n, queries, count, results);
+}
+
+inline void upperBoundBatch(const int* data, int n, const int* queries, int count, int* results) {
+    boundBatch<true>(data, n, queries, count, results);
+}
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ * Eytzinger (BFS-order) Static Search Index
+ *
+ * The sorted array is rearranged into the order of a breadth-first walk of
+ * the implicit binary search tree: node k has children 2k and 2k + 1
+ * (1-based). The first probes of every search now sit next to each other
+ * at the start of the array and stay in cache, and the 16 descendants of a
+ * node four levels down occupy one 64-byte cache line, so a single
+ * prefetch per step fetches the node needed four iterations later.
+ *
+ * The search loop is branchless (k = 2k + (tree[k] < target)). When it
+ * leaves the tree, the lower bound is the last node where the search went
+ * left, recovered by stripping the trailing 1 bits of k plus one more.
+ *
+ * Results are mapped back to positions in the original sorted array with a
+ * positions table, so the index is a drop-in replacement:
+ *     lowerBound(target): first position with sorted[i] >= target, or n
+ *     find(target):       a position holding target, or -1 (same as
+ *                         binarySearchIterative)
+ *
+ * Memory: tree (n + 1 ints, cache-line aligned) + positions (n + 1 ints).
+ */
+
+#ifndef EYTZINGER_INDEX_H
+#define EYTZINGER_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "branchless_search.h"
+
+// Prefetch the node this many levels below the current one (2^4 ints = one cache line)
+const int EYTZINGER_PREFETCH_LEVELS = 4;
+
+class EytzingerIndex {
+public:
+    explicit EytzingerIndex(const std::vector<int>& sorted)
+        : n((int)sorted.size()), storage(sorted.size() + 1 + 16), positions(sorted.size() + 1, -1) {
+        // Align node 0 to a cache line so each group of 16 siblings shares one line
+        uintptr_t address = (uintptr_t)storage.data();
+        tree = storage.data() + ((64 - address % 64) % 64) / sizeof(int);
+        int next = 0;
+        build(sorted, next, 1);
+        positions[0] = n;
+    }
+
+    EytzingerIndex(const EytzingerIndex&) = delete;
+    EytzingerIndex& operator=(const EytzingerIndex&) = delete;
+
+    int size() const {
+        return n;
+    }
+
+    // Bytes used by the index (the original array is not needed afterwards)
+    long long memoryBytes() const {
+        return (long long)(storage.size() + positions.size()) * sizeof(int);
+    }
+
+    // First position in the sorted array with value >= target, n if none
+    int lowerBound(int target) const {
+        int k = 1;
+        while (k <= n) {
+            prefetchDescendants(k);
+            k = 2 * k + (tree[k] < target);
+        }
+        return positions[lastLeftTurn(k)];
+    }
+
+    // Position of target in the sorted array, -1 if absent
+    int find(int target) const {
+        int k = 1;
+        while (k <= n) {
+            prefetchDescendants(k);
+            k = 2 * k + (tree[k] < target);
+        }
+        k = lastLeftTurn(k);
+        return (k != 0 && tree[k] == target) ? positions[k] : -1;
+    }
+
+    // results[i] = lowerBound(queries[i]), SEARCH_BATCH_SIZE queries in lockstep
+    void lowerBoundBatch(const int* queries, int count, int* results) const {
+        int k[SEARCH_BATCH_SIZE];
+        int levels = 0;
+        for (int m = n; m > 0; m >>= 1) levels++;
+
+        for (int start = 0; start < count; start += SEARCH_BATCH_SIZE) {
+            int group = std::min(SEARCH_BATCH_SIZE, count - start);
+            const int* q = queries + start;
+            for (int g = 0; g < group; g++) k[g] = 1;
+
+            // The last level may be partly missing, so a finished search stays put
+            for (int level = 0; level < levels; level++) {
+                for (int g = 0; g < group; g++) {
+                    if (k[g] <= n) k[g] = 2 * k[g] + (tree[k[g]] < q[g]);
+                }
+            }
+            for (int g = 0; g < group; g++) results[start + g] = positions[lastLeftTurn(k[g])];
+        }
+    }
+
+private:
+    // In-order walk of the implicit tree assigns sorted values to BFS slots
+    void build(const std::vector<int>& sorted, int& next, int k) {
+        if (k > n) return;
+        build(sorted, next, 2 * k);
+        tree[k] = sorted[next];
+        positions[k] = next;
+        next++;
+        build(sorted, next, 2 * k + 1);
+    }
+
+    // Prefetch the line of k's descendants EYTZINGER_PREFETCH_LEVELS down; the
+    // offset is computed in size_t and clamped to the last node, so it neither
+    // overflows int nor points past the tree near the bottom levels
+    void prefetchDescendants(int k) const {
+        size_t ahead = (size_t)k << EYTZINGER_PREFETCH_LEVELS;
+        SEARCH_PREFETCH(tree + std::min(ahead, (size_t)n));
+    }
+
+    // Node where the search last went left (0 if it never did)
+    static int lastLeftTurn(int k) {
+#if defined(__GNUC__) || defined(__clang__)
+        return k >> (__builtin_ctz(~(unsigned int)k) + 1);
+#else
+        while (k & 1) k >>= 1;
+        return k >> 1;
+#endif
+    }
+
+    int n;
+    std::vector<int> storage;
+    std::vector<int> positions;   // positions[k]: index in the sorted array, positions[0] = n
+    int* tree;
+};
+
+#endif
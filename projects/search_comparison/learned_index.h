@@ -0,0 +1,178 @@
+/*
+ * Learned Index (piecewise-linear model with an error bound)
+ *
+ * The sorted array is cut into segments; in each one the position of a key
+ * is predicted by a straight line through the segment's first key:
+ *     predicted = start + slope * (key - firstKey)
+ * The segments are fitted in one pass with a shrinking cone: the range of
+ * slopes that keeps every key seen so far within epsilon positions of its
+ * real (first) position is narrowed key by key, and a new segment starts
+ * when the range becomes empty. Every distinct key of the array is then
+ * guaranteed to be at most epsilon positions from its prediction.
+ *
+ * Lookup (two stages):
+ *   1. find the segment: a radix table indexed by the top bits of
+ *      (key - smallest key) gives the few segments whose first key falls in
+ *      the same bucket, and a branchless upper bound picks one of them
+ *   2. predict the position and search only [predicted - epsilon,
+ *      predicted + epsilon + 1] with a branchless lower bound
+ *   3. check the answer against its neighbours; keys absent from the array
+ *      can fall outside the window, and are then finished with a binary
+ *      search of the rest of the segment, left or right of it
+ *
+ * If the keys do not fit (more than one segment per LEARNED_MIN_SEGMENT_KEYS
+ * keys), the model is dropped and every lookup is a plain binary search.
+ *
+ * The index keeps a pointer to the array, which must outlive it:
+ *     lowerBound(target): first position with sorted[i] >= target, or n
+ *     find(target):       a position holding target, or -1 (same as
+ *                         binarySearchIterative)
+ */
+
+#ifndef LEARNED_INDEX_H
+#define LEARNED_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "branchless_search.h"
+
+// Default maximum distance between predicted and real position
+const int LEARNED_DEFAULT_EPSILON = 32;
+
+// Fewer keys per segment than this on average: use binary search instead
+const int LEARNED_MIN_SEGMENT_KEYS = 16;
+
+// Largest radix table over the segments (entries)
+const int LEARNED_MAX_RADIX_BUCKETS = 1 << 20;
+
+class LearnedIndex {
+public:
+    explicit LearnedIndex(const std::vector<int>& sorted, int epsilon = LEARNED_DEFAULT_EPSILON)
+        : data(sorted.data()), n((int)sorted.size()), epsilon(std::max(epsilon, 1)), radixShift(0) {
+        fit();
+        if ((long long)firstKeys.size() * LEARNED_MIN_SEGMENT_KEYS > n) {
+            firstKeys.clear();
+            segments.clear();
+        }
+        firstKeys.shrink_to_fit();
+        segments.shrink_to_fit();
+        buildRadixTable();
+    }
+
+    // False when the keys fitted badly and lookups are plain binary searches
+    bool usesModel() const {
+        return !segments.empty();
+    }
+
+    int segmentCount() const {
+        return (int)segments.size();
+    }
+
+    int errorBound() const {
+        return epsilon;
+    }
+
+    // Bytes of the model (the array itself is not copied)
+    long long modelBytes() const {
+        return (long long)(firstKeys.size() + radixTable.size()) * sizeof(int) +
+               (long long)segments.size() * sizeof(Segment);
+    }
+
+    // First position in the sorted array with value >= target, n if none
+    int lowerBound(int target) const {
+        if (segments.empty()) return lowerBoundBranchless(data, n, target);
+
+        if (target < firstKeys[0]) return 0;
+        uint64_t bucket = (uint64_t)((long long)target - firstKeys[0]) >> radixShift;
+        bucket = std::min(bucket, (uint64_t)radixTable.size() - 2);
+        int first = radixTable[bucket];
+        int s = first - 1 + upperBoundBranchless(firstKeys.data() + first, radixTable[bucket + 1] - first, target);
+
+        const Segment& segment = segments[s];
+        double offset = segment.slope * ((double)target - firstKeys[s]);
+        int predicted = segment.start + (int)std::min(offset, (double)(segment.end - segment.start));
+        int low = std::max(predicted - epsilon, 0);
+        int high = std::min(predicted + epsilon + 1, n);
+
+        int position = low + lowerBoundBranchless(data + low, high - low, target);
+        // The answer is in [segment.start, segment.end]: outside the window, search only that part
+        if (position == low && low > 0 && data[low - 1] >= target) {
+            return segment.start + lowerBoundBranchless(data + segment.start, low - segment.start, target);
+        }
+        if (position == high && high < n && data[high] < target) {
+            return high + 1 + lowerBoundBranchless(data + high + 1, segment.end - high - 1, target);
+        }
+        return position;
+    }
+
+    // Position of target in the sorted array, -1 if absent
+    int find(int target) const {
+        int position = lowerBound(target);
+        return (position < n && data[position] == target) ? position : -1;
+    }
+
+private:
+    struct Segment {
+        double slope;
+        int start;   // position of the segment's first key
+        int end;     // position of the next segment's first key (n for the last)
+    };
+
+    // Shrinking cone over the points (key, first position of key)
+    void fit() {
+        int i = 0;
+        while (i < n) {
+            int start = i;
+            double x0 = data[start];
+            double low = 0, high = 1e300;   // allowed slopes
+            i = nextDistinct(i);
+            while (i < n) {
+                double dx = (double)data[i] - x0;
+                double slopeLow = (i - start - epsilon) / dx;
+                double slopeHigh = (i - start + epsilon) / dx;
+                if (slopeLow > high || slopeHigh < low) break;
+                low = std::max(low, slopeLow);
+                high = std::min(high, slopeHigh);
+                i = nextDistinct(i);
+            }
+            double slope = (high == 1e300) ? 0 : (low + high) / 2;
+            firstKeys.push_back(data[start]);
+            segments.push_back(Segment{slope, start, i});
+        }
+    }
+
+    // radixTable[b] = first segment whose first key is in bucket b or later
+    void buildRadixTable() {
+        if (segments.empty()) return;
+        int buckets = 1;
+        while (buckets < (int)segments.size() && buckets < LEARNED_MAX_RADIX_BUCKETS) buckets *= 2;
+        uint64_t range = (uint64_t)((long long)firstKeys.back() - firstKeys[0]);
+        radixShift = 0;
+        while ((range >> radixShift) >= (uint64_t)buckets) radixShift++;
+
+        radixTable.assign(buckets + 1, (int)segments.size());
+        for (int s = (int)segments.size() - 1; s >= 0; s--) {
+            uint64_t bucket = (uint64_t)((long long)firstKeys[s] - firstKeys[0]) >> radixShift;
+            radixTable[bucket] = s;
+        }
+        for (int b = buckets - 1; b >= 0; b--) radixTable[b] = std::min(radixTable[b], radixTable[b + 1]);
+    }
+
+    // First position after the run of keys equal to data[i]
+    int nextDistinct(int i) const {
+        int key = data[i];
+        while (i < n && data[i] == key) i++;
+        return i;
+    }
+
+    const int* data;
+    int n;
+    int epsilon;
+    std::vector<int> firstKeys;       // first key of every segment, for the segment search
+    std::vector<Segment> segments;
+    std::vector<int> radixTable;      // buckets + 1 entries, the last one = segment count
+    int radixShift;
+};
+
+#endif
@@ -0,0 +1,238 @@
+/*
+ * Linear Scan Kernels (unsorted int columns)
+ *
+ * - findFirst(data, n, target):   index of the first match, -1 if none
+ * - countEqual(data, n, target):  number of matches
+ * - findAll(data, n, target, out): appends every match position to out
+ * - matchBitmap(data, n, target, bitmap): bit i of the bitmap is set when
+ *   data[i] == target ((n + 63) / 64 words)
+ *
+ * The AVX2 kernels compare 8 ints per instruction. findFirst and
+ * countEqual take 32 ints per iteration (four compares OR-ed or summed)
+ * so the loop is bound by loads, not by the test-and-branch. The scalar
+ * fallbacks use the same blocking without a branch per element.
+ *
+ * findFirstParallel splits the column into chunks that the threads claim
+ * in increasing order. Once a match is known, chunks starting after it are
+ * skipped, but every chunk before it is still scanned, so the result is
+ * the first match, exactly as in the serial scan.
+ */
+
+#ifndef LINEAR_SCAN_H
+#define LINEAR_SCAN_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "simd_support.h"
+
+// Ints per block of the blocked scans (four AVX2 registers)
+const int SCAN_BLOCK = 32;
+
+// Ints per chunk claimed by one thread (256 KB)
+const int SCAN_CHUNK = 1 << 16;
+
+inline int findFirstScalar(const int* data, int n, int target) {
+    int i = 0;
+    for (; i + SCAN_BLOCK <= n; i += SCAN_BLOCK) {
+        bool any = false;
+        for (int j = 0; j < SCAN_BLOCK; j++) any |= (data[i + j] == target);
+        if (any) break;
+    }
+    for (; i < n; i++) {
+        if (data[i] == target) return i;
+    }
+    return -1;
+}
+
+inline long long countEqualScalar(const int* data, int n, int target) {
+    long long count = 0;
+    for (int i = 0; i < n; i++) count += (data[i] == target);
+    return count;
+}
+
+inline int findAllScalar(const int* data, int n, int target, std::vector<int>& out) {
+    size_t before = out.size();
+    for (int i = 0; i < n; i++) {
+        if (data[i] == target) out.push_back(i);
+    }
+    return (int)(out.size() - before);
+}
+
+inline void matchBitmapScalar(const int* data, int n, int target, uint64_t* bitmap) {
+    for (int word = 0; word * 64 < n; word++) {
+        int begin = word * 64;
+        int end = std::min(n, begin + 64);
+        uint64_t bits = 0;
+        for (int i = begin; i < end; i++) bits |= (uint64_t)(data[i] == target) << (i - begin);
+        bitmap[word] = bits;
+    }
+}
+
+#if SEARCH_HAS_AVX2
+
+SEARCH_AVX2 inline int matchMask8(const int* data, __m256i key) {
+    __m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)data), key);
+    return _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+}
+
+SEARCH_AVX2 inline int findFirstAvx2(const int* data, int n, int target) {
+    __m256i key = _mm256_set1_epi32(target);
+    int i = 0;
+    for (; i + SCAN_BLOCK <= n; i += SCAN_BLOCK) {
+        __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), key);
+        __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i + 8)), key);
+        __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i + 16)), key);
+        __m256i d = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i + 24)), key);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if (!_mm256_testz_si256(any, any)) break;
+    }
+    for (; i + 8 <= n; i += 8) {
+        int mask = matchMask8(data + i, key);
+        if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    for (; i < n; i++) {
+        if (data[i] == target) return i;
+    }
+    return -1;
+}
+
+SEARCH_AVX2 inline long long countEqualAvx2(const int* data, int n, int target) {
+    __m256i key = _mm256_set1_epi32(target);
+    // Lanes count down by one per match (cmpeq gives -1); at most n / 32 per lane
+    __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256();
+    __m256i sum2 = _mm256_setzero_si256(), sum3 = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + SCAN_BLOCK <= n; i += SCAN_BLOCK) {
+        sum0 = _mm256_add_epi32(sum0, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), key));
+        sum1 = _mm256_add_epi32(sum1, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i + 8)), key));
+        sum2 = _mm256_add_epi32(sum2, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i + 16)), key));
+        sum3 = _mm256_add_epi32(sum3, _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i + 24)), key));
+    }
+    int lanes[4][8];
+    _mm256_storeu_si256((__m256i*)lanes[0], sum0);
+    _mm256_storeu_si256((__m256i*)lanes[1], sum1);
+    _mm256_storeu_si256((__m256i*)lanes[2], sum2);
+    _mm256_storeu_si256((__m256i*)lanes[3], sum3);
+    long long count = 0;
+    for (int r = 0; r < 4; r++) {
+        for (int lane = 0; lane < 8; lane++) count -= lanes[r][lane];
+    }
+    return count + countEqualScalar(data + i, n - i, target);
+}
+
+SEARCH_AVX2 inline int findAllAvx2(const int* data, int n, int target, std::vector<int>& out) {
+    __m256i key = _mm256_set1_epi32(target);
+    size_t before = out.size();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        int mask = matchMask8(data + i, key);
+        while (mask != 0) {
+            out.push_back(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    for (; i < n; i++) {
+        if (data[i] == target) out.push_back(i);
+    }
+    return (int)(out.size() - before);
+}
+
+SEARCH_AVX2 inline void matchBitmapAvx2(const int* data, int n, int target, uint64_t* bitmap) {
+    __m256i key = _mm256_set1_epi32(target);
+    int full = n / 64;
+    for (int word = 0; word < full; word++) {
+        const int* block = data + word * 64;
+        uint64_t bits = 0;
+        for (int part = 0; part < 8; part++) bits |= (uint64_t)matchMask8(block + part * 8, key) << (part * 8);
+        bitmap[word] = bits;
+    }
+    if (full * 64 < n) matchBitmapScalar(data + full * 64, n - full * 64, target, bitmap + full);
+}
+
+#endif
+
+inline int findFirst(const int* data, int n, int target) {
+#if SEARCH_HAS_AVX2
+    if (cpuHasAvx2()) return findFirstAvx2(data, n, target);
+#endif
+    return findFirstScalar(data, n, target);
+}
+
+inline long long countEqual(const int* data, int n, int target) {
+#if SEARCH_HAS_AVX2
+    if (cpuHasAvx2()) return countEqualAvx2(data, n, target);
+#endif
+    return countEqualScalar(data, n, target);
+}
+
+// Appends the match positions to out, returns how many were found
+inline int findAll(const int* data, int n, int target, std::vector<int>& out) {
+#if SEARCH_HAS_AVX2
+    if (cpuHasAvx2()) return findAllAvx2(data, n, target, out);
+#endif
+    return findAllScalar(data, n, target, out);
+}
+
+// bitmap must hold (n + 63) / 64 words
+inline void matchBitmap(const int* data, int n, int target, uint64_t* bitmap) {
+#if SEARCH_HAS_AVX2
+    if (cpuHasAvx2()) {
+        matchBitmapAvx2(data, n, target, bitmap);
+        return;
+    }
+#endif
+    matchBitmapScalar(data, n, target, bitmap);
+}
+
+// Runs worker(0..threads-1), the caller being thread 0
+template <typename Worker>
+void runScanThreads(int threads, Worker worker) {
+    std::vector<std::thread> helpers;
+    for (int t = 1; t < threads; t++) helpers.push_back(std::thread(worker, t));
+    worker(0);
+    for (std::thread& helper : helpers) helper.join();
+}
+
+// findFirst over chunks claimed in order by several threads
+inline int findFirstParallel(const int* data, int n, int target, int threads) {
+    if (threads <= 1 || n <= SCAN_CHUNK) return findFirst(data, n, target);
+
+    std::atomic<int> nextChunk(0);
+    std::atomic<int> first(n);   // n = no match yet
+    runScanThreads(threads, [&](int) {
+        while (true) {
+            long long begin = (long long)nextChunk.fetch_add(1) * SCAN_CHUNK;
+            if (begin >= n || begin >= first.load()) break;
+            int length = (int)std::min((long long)SCAN_CHUNK, n - begin);
+            int found = findFirst(data + begin, length, target);
+            if (found < 0) continue;
+
+            int position = (int)begin + found;
+            int current = first.load();
+            while (position < current && !first.compare_exchange_weak(current, position)) {
+            }
+            break;
+        }
+    });
+    return first.load() < n ? first.load() : -1;
+}
+
+// countEqual with one contiguous part per thread
+inline long long countEqualParallel(const int* data, int n, int target, int threads) {
+    if (threads <= 1 || n <= SCAN_CHUNK) return countEqual(data, n, target);
+
+    std::vector<long long> counts(threads, 0);
+    runScanThreads(threads, [&](int t) {
+        long long begin = (long long)n * t / threads;
+        long long end = (long long)n * (t + 1) / threads;
+        counts[t] = countEqual(data + begin, (int)(end - begin), target);
+    });
+    long long total = 0;
+    for (long long count : counts) total += count;
+    return total;
+}
+
+#endif
@@ -0,0 +1,685 @@
+/*
+ * Search Algorithms Comparison Tool
+ *
+ * This program compares search algorithms by measuring the average time
+ * per lookup on sorted arrays from L1-cache size up to DRAM size.
+ */
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <random>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+#include <thread>
+#include "branchless_search.h"
+#include "eytzinger_index.h"
+#include "static_btree.h"
+#include "linear_scan.h"
+#include "learned_index.h"
+#include "mapped_search.h"
+using namespace std;
+using namespace std::chrono;
+
+// Seed for all generated inputs (fixed, so runs are reproducible)
+unsigned int inputSeed = 42;
+
+// Largest benchmark arrays: 2^30 ints (4 GB). Sizes, keys (2i) and the query
+// range [0, 2n) are ints, so larger arrays would overflow
+const long long SEARCH_MAX_BYTES = 4LL << 30;
+
+// The Eytzinger index walks to node 2n + 1 in an int, so it needs n < 2^30:
+// its runs (and the static B+-tree runs that compare with it) stop at 1 GB arrays
+const long long EYTZINGER_MAX_BYTES = 2LL << 30;
+
+// Iterative Binary Search
+int binarySearchIterative(const vector<int>& arr, int target) {
+    int left = 0;
+    int right = arr.size() - 1;
+
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+        if (arr[mid] == target) {
+            return mid;
+        }
+        if (arr[mid] < target) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+    return -1;
+}
+
+// Recursive Binary Search
+int binarySearchRecursive(const vector<int>& arr, int target, int left, int right) {
+    if (left <= right) {
+        int mid = left + (right - left) / 2;
+        if (arr[mid] == target) {
+            return mid;
+        }
+        if (arr[mid] > target) {
+            return binarySearchRecursive(arr, target, left, mid - 1);
+        }
+        return binarySearchRecursive(arr, target, mid + 1, right);
+    }
+    return -1;
+}
+
+// Linear Search (from assignments/search/linear_search.cpp)
+int linearSearch(const vector<int>& arr, int target) {
+    int n = arr.size();
+    for (int i = 0; i < n; i++) {
+        if (arr[i] == target) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Sorted keys 0, 2, 4, ... so that random queries in [0, 2n) hit half the time
+vector<int> generateSortedKeys(int size) {
+    vector<int> keys(size);
+    for (int i = 0; i < size; i++) keys[i] = 2 * i;
+    return keys;
+}
+
+vector<int> generateQueries(int count, int size) {
+    vector<int> queries(count);
+    mt19937 gen(inputSeed + size);
+    uniform_int_distribution<int> dis(0, (int)(2LL * size - 1));
+    for (int& query : queries) query = dis(gen);
+    return queries;
+}
+
+// Sorted keys with a real-world shape:
+//   "sequential": ids counting up by one, 1% followed by a gap of up to 1000
+//   "timestamps": event times, exponential gaps (mean 8) with a daily rate cycle
+//   "lognormal":  heavy-tailed values with many duplicates (a poor fit for lines)
+vector<int> generateShapedKeys(int size, const string& shape) {
+    vector<int> keys(size);
+    mt19937 gen(inputSeed + size);
+    if (shape == "sequential") {
+        uniform_int_distribution<int> gap(1, 1000);
+        long long key = 0;
+        for (int i = 0; i < size; i++) {
+            keys[i] = (int)key;
+            key += (gen() % 100 == 0) ? gap(gen) : 1;
+        }
+    } else if (shape == "timestamps") {
+        exponential_distribution<double> wait(1.0);
+        double time = 0;
+        for (int i = 0; i < size; i++) {
+            keys[i] = (int)time;
+            double rate = 1.0 + 0.75 * sin(time * 2 * 3.14159265358979 / 86400);
+            time += 8 * wait(gen) / rate;
+        }
+    } else {
+        lognormal_distribution<double> value(0.0, 2.0);
+        for (int& key : keys) key = (int)min(value(gen) * 1e6, 2e9);
+        sort(keys.begin(), keys.end());
+    }
+    return keys;
+}
+
+// Half existing keys, half uniform over the key range
+vector<int> generateKeyQueries(int count, const vector<int>& keys) {
+    vector<int> queries(count);
+    mt19937 gen(inputSeed + (unsigned int)keys.size());
+    uniform_int_distribution<int> index(0, (int)keys.size() - 1);
+    uniform_int_distribution<int> value(keys.front(), keys.back());
+    for (int i = 0; i < count; i++) queries[i] = (i % 2 == 0) ? keys[index(gen)] : value(gen);
+    return queries;
+}
+
+// Position of target or -1, from a lower bound (for checking against the originals)
+int foundIndex(const vector<int>& keys, int bound, int target) {
+    return (bound < (int)keys.size() && keys[bound] == target) ? bound : -1;
+}
+
+// Average nanoseconds per query; search(query) returns the found index or -1,
+// and every answer is checked against std::lower_bound (with duplicate keys
+// any position holding the query is a correct answer)
+template <typename Search>
+double measureNsPerQuery(Search search, const vector<int>& keys, const vector<int>& queries, bool& correct) {
+    vector<int> answers(queries.size());
+    auto start = high_resolution_clock::now();
+    for (size_t i = 0; i < queries.size(); i++) answers[i] = search(queries[i]);
+    auto stop = high_resolution_clock::now();
+
+    for (size_t i = 0; i < queries.size(); i++) {
+        int bound = lower_bound(keys.begin(), keys.end(), queries[i]) - keys.begin();
+        if (foundIndex(keys, bound, queries[i]) < 0) {
+            if (answers[i] != -1) correct = false;
+        } else if (answers[i] < 0 || answers[i] >= (int)keys.size() || keys[answers[i]] != queries[i]) {
+            correct = false;
+        }
+    }
+    return duration_cast<nanoseconds>(stop - start).count() / (double)queries.size();
+}
+
+// Batched lookups: the whole query array goes through one call
+template <typename BatchSearch>
+double measureBatchNsPerQuery(BatchSearch search, const vector<int>& keys, const vector<int>& queries,
+                              bool& correct) {
+    vector<int> bounds(queries.size());
+    auto start = high_resolution_clock::now();
+    search(queries.data(), (int)queries.size(), bounds.data());
+    auto stop = high_resolution_clock::now();
+
+    for (size_t i = 0; i < queries.size(); i++) {
+        int bound = lower_bound(keys.begin(), keys.end(), queries[i]) - keys.begin();
+        if (bounds[i] != bound) correct = false;
+    }
+    return duration_cast<nanoseconds>(stop - start).count() / (double)queries.size();
+}
+
+string formatBytes(long long bytes) {
+    const char* units[] = {"B", "KB", "MB", "GB"};
+    int unit = 0;
+    double value = (double)bytes;
+    while (value >= 1024 && unit < 3) {
+        value /= 1024;
+        unit++;
+    }
+    return to_string((long long)value) + " " + units[unit];
+}
+
+// Binary search variants on sorted arrays from L1 to DRAM
+void runBinarySearchBenchmark(long long maxBytes, int queryCount) {
+    cout << "Binary search, " << queryCount << " random queries per size (ns per query)\n" << endl;
+    cout << setw(10) << "Array" << setw(12) << "Elements" << setw(12) << "Iterative" << setw(12)
+         << "Recursive" << setw(12) << "std::lower" << setw(12) << "Branchless" << setw(12)
+         << "+Prefetch" << setw(12) << "Batched" << endl;
+    cout << string(94, '-') << endl;
+
+    for (long long size = 1024; size * (long long)sizeof(int) <= maxBytes; size *= 4) {
+        vector<int> keys = generateSortedKeys((int)size);
+        vector<int> queries = generateQueries(queryCount, (int)size);
+        const int* data = keys.data();
+        int n = (int)size;
+        bool correct = true;
+
+        double iterative = measureNsPerQuery([&keys](int q) {
+            return binarySearchIterative(keys, q);
+        }, keys, queries, correct);
+        double recursive = measureNsPerQuery([&keys, n](int q) {
+            return binarySearchRecursive(keys, q, 0, n - 1);
+        }, keys, queries, correct);
+        double standard = measureNsPerQuery([&keys](int q) {
+            return foundIndex(keys, lower_bound(keys.begin(), keys.end(), q) - keys.begin(), q);
+        }, keys, queries, correct);
+        double branchless = measureNsPerQuery([&keys, data, n](int q) {
+            return foundIndex(keys, boundBranchless<false, false>(data, n, q), q);
+        }, keys, queries, correct);
+        double prefetch = measureNsPerQuery([&keys, data, n](int q) {
+            return foundIndex(keys, lowerBoundBranchless(data, n, q), q);
+        }, keys, queries, correct);
+        double batched = measureBatchNsPerQuery([data, n](const int* q, int count, int* results) {
+            lowerBoundBatch(data, n, q, count, results);
+        }, keys, queries, correct);
+
+        cout << setw(10) << formatBytes(size * sizeof(int)) << setw(12) << size << fixed << setprecision(1)
+             << setw(12) << iterative << setw(12) << recursive << setw(12) << standard
+             << setw(12) << branchless << setw(12) << prefetch << setw(12) << batched
+             << (correct ? "" : "  (wrong result!)") << endl;
+    }
+
+    cout << "\nBranchless: conditional moves, fixed log2(n) iterations" << endl;
+    cout << "+Prefetch: both possible next midpoints prefetched" << endl;
+    cout << "Batched: " << SEARCH_BATCH_SIZE << " queries searched in lockstep" << endl;
+}
+
+// Eytzinger index against the sorted-array searches, with build cost and memory
+void runEytzingerBenchmark(long long maxBytes, int queryCount) {
+    cout << "Eytzinger index, " << queryCount << " random queries per size (ns per query)\n" << endl;
+    cout << setw(10) << "Array" << setw(12) << "Elements" << setw(12) << "Build ms" << setw(12)
+         << "Memory" << setw(12) << "Iterative" << setw(12) << "+Prefetch" << setw(12) << "Eytzinger"
+         << setw(12) << "Batched" << endl;
+    cout << string(94, '-') << endl;
+
+    for (long long size = 1024; size * (long long)sizeof(int) <= maxBytes; size *= 4) {
+        vector<int> keys = generateSortedKeys((int)size);
+        vector<int> queries = generateQueries(queryCount, (int)size);
+        const int* data = keys.data();
+        int n = (int)size;
+        bool correct = true;
+
+        auto start = high_resolution_clock::now();
+        EytzingerIndex index(keys);
+        auto stop = high_resolution_clock::now();
+        double buildMs = duration_cast<microseconds>(stop - start).count() / 1000.0;
+        double overhead = (double)index.memoryBytes() / (size * sizeof(int));
+
+        double iterative = measureNsPerQuery([&keys](int q) {
+            return binarySearchIterative(keys, q);
+        }, keys, queries, correct);
+        double prefetch = measureNsPerQuery([&keys, data, n](int q) {
+            return foundIndex(keys, lowerBoundBranchless(data, n, q), q);
+        }, keys, queries, correct);
+        double eytzinger = measureNsPerQuery([&index](int q) {
+            return index.find(q);
+        }, keys, queries, correct);
+        double batched = measureBatchNsPerQuery([&index](const int* q, int count, int* results) {
+            index.lowerBoundBatch(q, count, results);
+        }, keys, queries, correct);
+
+        cout << setw(10) << formatBytes(size * sizeof(int)) << setw(12) << size << fixed << setprecision(1)
+             << setw(12) << buildMs << setw(11) << overhead << "x" << setw(12) << iterative
+             << setw(12) << prefetch << setw(12) << eytzinger << setw(12) << batched
+             << (correct ? "" : "  (wrong result!)") << endl;
+    }
+
+    cout << "\nMemory: index size relative to the sorted array (tree + position map)" << endl;
+    cout << "Eytzinger: BFS layout, prefetch " << EYTZINGER_PREFETCH_LEVELS << " levels ahead" << endl;
+    cout << "Batched: " << SEARCH_BATCH_SIZE << " Eytzinger lower bounds in lockstep" << endl;
+}
+
+// Static B+-tree (S-tree) against binary search and the Eytzinger index
+void runStaticBTreeBenchmark(long long maxBytes, int queryCount) {
+    cout << "S-tree (static B+-tree, " << simdKernelName() << " node search), " << queryCount
+         << " random queries per size (ns per query)\n" << endl;
+    cout << setw(10) << "Array" << setw(12) << "Elements" << setw(8) << "Height" << setw(12) << "Build ms"
+         << setw(10) << "Memory" << setw(12) << "Iterative" << setw(12) << "Eytzinger" << setw(12)
+         << "S-tree" << setw(12) << "Batched" << endl;
+    cout << string(100, '-') << endl;
+
+    for (long long size = 1024; size * (long long)sizeof(int) <= maxBytes; size *= 4) {
+        vector<int> keys = generateSortedKeys((int)size);
+        vector<int> queries = generateQueries(queryCount, (int)size);
+        bool correct = true;
+
+        auto start = high_resolution_clock::now();
+        StaticBTree tree(keys);
+        auto stop = high_resolution_clock::now();
+        double buildMs = duration_cast<microseconds>(stop - start).count() / 1000.0;
+        double overhead = (double)tree.memoryBytes() / (size * sizeof(int));
+
+        double iterative = measureNsPerQuery([&keys](int q) {
+            return binarySearchIterative(keys, q);
+        }, keys, queries, correct);
+        double eytzinger;
+        {
+            EytzingerIndex index(keys);
+            eytzinger = measureNsPerQuery([&index](int q) {
+                return index.find(q);
+            }, keys, queries, correct);
+        }
+        double stree = measureNsPerQuery([&tree](int q) {
+            return tree.find(q);
+        }, keys, queries, correct);
+        double batched = measureBatchNsPerQuery([&tree](const int* q, int count, int* results) {
+            tree.lowerBoundBatch(q, count, results);
+        }, keys, queries, correct);
+
+        cout << setw(10) << formatBytes(size * sizeof(int)) << setw(12) << size << setw(8) << tree.height()
+             << fixed << setprecision(1) << setw(12) << buildMs << setw(9) << overhead << "x"
+             << setw(12) << iterative << setw(12) << eytzinger << setw(12) << stree << setw(12) << batched
+             << (correct ? "" : "  (wrong result!)") << endl;
+    }
+
+    cout << "\nMemory: index size relative to the sorted array (leaves hold a copy of the keys)" << endl;
+    cout << "S-tree: " << BTREE_NODE_KEYS << " keys per node (one cache line), " << BTREE_FANOUT
+         << " children per internal node" << endl;
+    cout << "Batched: " << SEARCH_BATCH_SIZE << " S-tree lower bounds in lockstep" << endl;
+}
+
+// Learned index against binary search and the S-tree on differently shaped keys
+void runLearnedIndexBenchmark(long long maxBytes, int queryCount) {
+    cout << "Learned index (piecewise linear, error bound " << LEARNED_DEFAULT_EPSILON << "), " << queryCount
+         << " queries per size (ns per query)\n" << endl;
+    cout << setw(10) << "Keys" << setw(12) << "Shape" << setw(10) << "Segments" << setw(10) << "Model"
+         << setw(10) << "Build ms" << setw(11) << "Iterative" << setw(11) << "Branchless" << setw(10)
+         << "S-tree" << setw(10) << "Learned" << endl;
+    cout << string(94, '-') << endl;
+
+    const string shapes[] = {"sequential", "timestamps", "lognormal"};
+    for (long long size = 65536; size * (long long)sizeof(int) <= maxBytes; size *= 4) {
+        for (const string& shape : shapes) {
+            vector<int> keys = generateShapedKeys((int)size, shape);
+            vector<int> queries = generateKeyQueries(queryCount, keys);
+            const int* data = keys.data();
+            int n = (int)size;
+            bool correct = true;
+
+            auto start = high_resolution_clock::now();
+            LearnedIndex index(keys);
+            auto stop = high_resolution_clock::now();
+            double buildMs = duration_cast<microseconds>(stop - start).count() / 1000.0;
+
+            double iterative = measureNsPerQuery([&keys](int q) {
+                return binarySearchIterative(keys, q);
+            }, keys, queries, correct);
+            double branchless = measureNsPerQuery([&keys, data, n](int q) {
+                return foundIndex(keys, lowerBoundBranchless(data, n, q), q);
+            }, keys, queries, correct);
+            double stree;
+            {
+                StaticBTree tree(keys);
+                stree = measureNsPerQuery([&tree](int q) {
+                    return tree.find(q);
+                }, keys, queries, correct);
+            }
+            double learned = measureNsPerQuery([&index](int q) {
+                return index.find(q);
+            }, keys, queries, correct);
+
+            cout << setw(10) << size << setw(12) << shape << setw(10) << index.segmentCount() << setw(10)
+                 << (index.usesModel() ? formatBytes(index.modelBytes()) : "fallback") << fixed << setprecision(1)
+                 << setw(10) << buildMs << setw(11) << iterative << setw(11) << branchless << setw(10) << stree
+                 << setw(10) << learned << (correct ? "" : "  (wrong result!)") << endl;
+        }
+    }
+
+    cout << "\nModel: segment first keys + slopes; fallback = fitted too badly, binary search used" << endl;
+    cout << "Queries: half existing keys, half uniform over the key range" << endl;
+}
+
+// Lookups in a memory-mapped sorted key file: time, pages read and page faults
+// per lookup. Every strategy gets a fresh mapping of a file dropped from the
+// page cache for the timed run; a second, untimed run through a PageTrace
+// counts the distinct pages of every lookup.
+void runMappedSearch(const string& path, int queryCount, const string& mix) {
+    MappedKeyFile file;
+    auto start = high_resolution_clock::now();
+    bool opened = file.open(path);
+    auto stop = high_resolution_clock::now();
+    if (!opened) {
+        cout << "Error: " << file.lastError() << endl;
+        return;
+    }
+    long long n = file.size();
+    if (n == 0) {
+        cout << "Error: " << path << " holds no keys" << endl;
+        return;
+    }
+    const int* data = file.data();
+    if (!is_sorted(data, data + min(n, 1LL << 20)) || data[0] > data[n - 1]) {
+        cout << "Error: " << path << " is not sorted" << endl;
+        return;
+    }
+
+    cout << "Memory-mapped search: " << path << ", " << n << " keys (" << formatBytes(n * sizeof(int))
+         << "), mapped in " << duration_cast<microseconds>(stop - start).count() << " us" << endl;
+
+    // Queries: half existing keys, half values between them; "recent" keeps
+    // them in the last 0.1% of the file (lookups of newly appended keys)
+    long long from = (mix == "recent") ? n - max(1LL, n / 1000) : 0;
+    vector<int> queries(queryCount);
+    mt19937_64 gen(inputSeed);
+    uniform_int_distribution<long long> position(from, n - 1);
+    uniform_int_distribution<int> value(data[from], data[n - 1]);
+    for (int i = 0; i < queryCount; i++) queries[i] = (i % 2 == 0) ? data[position(gen)] : value(gen);
+    vector<long long> expected(queryCount);
+    for (int i = 0; i < queryCount; i++) expected[i] = lower_bound(data, data + n, queries[i]) - data;
+
+    // Built once, like an index kept next to the file: it reads every stride-th key
+    start = high_resolution_clock::now();
+    SparseKeyIndex sparse(data, n);
+    stop = high_resolution_clock::now();
+    cout << "Sparse index built in " << duration_cast<milliseconds>(stop - start).count() << " ms" << endl;
+
+    cout << queryCount << " " << mix << " lookups, cold mapping per strategy\n" << endl;
+    cout << setw(16) << "Strategy" << setw(12) << "ns/lookup" << setw(13) << "pages/lookup" << setw(14)
+         << "faults/lookup" << setw(13) << "major/lookup" << setw(12) << "Memory" << endl;
+    cout << string(80, '-') << endl;
+
+    const char* names[] = {"Binary", "Interpolation", "Gallop (start)", "Gallop (end)", "Sparse index"};
+    for (int strategy = 0; strategy < 5; strategy++) {
+        // Remap first: pages still mapped by the old mapping cannot be evicted
+        if (!file.open(path)) {
+            cout << "Error: " << file.lastError() << endl;
+            return;
+        }
+        file.evictFromCache();
+        data = file.data();
+
+        sparse.attach(data);
+        long long faults = processPageFaults(false);
+        long long major = processPageFaults(true);
+        vector<long long> answers(queryCount);
+        start = high_resolution_clock::now();
+        for (int i = 0; i < queryCount; i++) {
+            int q = queries[i];
+            switch (strategy) {
+                case 0: answers[i] = bisectLowerBound(data, 0, n, q); break;
+                case 1: answers[i] = interpolationSearch(data, n, q); break;
+                case 2: answers[i] = gallopSearch(data, n, q, 0); break;
+                case 3: answers[i] = gallopSearch(data, n, q, n - 1); break;
+                default: answers[i] = sparse.lowerBound(q); break;
+            }
+        }
+        stop = high_resolution_clock::now();
+        faults = processPageFaults(false) - faults;
+        major = processPageFaults(true) - major;
+
+        PageTrace trace(data);
+        long long pages = 0;
+        for (int i = 0; i < queryCount; i++) {
+            int q = queries[i];
+            switch (strategy) {
+                case 0: bisectLowerBound(trace, 0, n, q); break;
+                case 1: interpolationSearch(trace, n, q); break;
+                case 2: gallopSearch(trace, n, q, 0); break;
+                case 3: gallopSearch(trace, n, q, n - 1); break;
+                default: sparse.lowerBound(trace, q); break;
+            }
+            pages += trace.takeDistinctPages();
+        }
+
+        double ns = duration_cast<nanoseconds>(stop - start).count() / (double)queryCount;
+        cout << setw(16) << names[strategy] << fixed << setprecision(1) << setw(12) << ns << setprecision(2)
+             << setw(13) << pages / (double)queryCount << setw(14) << faults / (double)queryCount << setw(13) << major / (double)queryCount << setw(12)
+             << (strategy == 4 ? formatBytes(sparse.memoryBytes()) : "-")
+             << (answers == expected ? "" : "  (wrong result!)") << endl;
+    }
+
+    cout << "\nPages: distinct pages of the file read by each lookup" << endl;
+    cout << "Faults: page faults of the process during the timed lookups (major = read from disk);" << endl;
+    cout << "        one fault can map several cached pages, so faults undercount pages" << endl;
+    cout << "Sparse index: every " << SPARSE_INDEX_STRIDE << "th key in memory (one or two pages per lookup)" << endl;
+}
+
+// Unsorted column with values in [0, 1000): every value matches about 0.1% of rows
+vector<int> generateColumn(int size) {
+    vector<int> column(size);
+    mt19937 gen(inputSeed + size);
+    uniform_int_distribution<int> dis(0, 999);
+    for (int& value : column) value = dis(gen);
+    return column;
+}
+
+// Reads every byte of the column (XOR reduction): the bandwidth ceiling for a scan
+#if SEARCH_HAS_AVX2
+SEARCH_AVX2 int xorReduceAvx2(const int* data, int n) {
+    __m256i a = _mm256_setzero_si256(), b = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        a = _mm256_xor_si256(a, _mm256_loadu_si256((const __m256i*)(data + i)));
+        b = _mm256_xor_si256(b, _mm256_loadu_si256((const __m256i*)(data + i + 8)));
+    }
+    int lanes[8];
+    _mm256_storeu_si256((__m256i*)lanes, _mm256_xor_si256(a, b));
+    int result = 0;
+    for (int lane = 0; lane < 8; lane++) result ^= lanes[lane];
+    for (; i < n; i++) result ^= data[i];
+    return result;
+}
+#endif
+
+int xorReduce(const int* data, int n) {
+#if SEARCH_HAS_AVX2
+    if (cpuHasAvx2()) return xorReduceAvx2(data, n);
+#endif
+    int result = 0;
+    for (int i = 0; i < n; i++) result ^= data[i];
+    return result;
+}
+
+// Time stamp counter ticks per nanosecond (0 if there is no TSC)
+double cyclesPerNs() {
+#if SEARCH_HAS_AVX2
+    auto start = steady_clock::now();
+    unsigned long long ticks = __rdtsc();
+    while (steady_clock::now() - start < milliseconds(50)) {
+    }
+    ticks = __rdtsc() - ticks;
+    return ticks / (double)duration_cast<nanoseconds>(steady_clock::now() - start).count();
+#else
+    return 0;
+#endif
+}
+
+// GB/s of scan(), repeated until about 256 MB were read so small columns are measurable
+template <typename Scan>
+double measureScanGBs(Scan scan, long long bytes) {
+    long long repeats = max(1LL, (256LL << 20) / bytes);
+    auto start = high_resolution_clock::now();
+    for (long long r = 0; r < repeats; r++) scan();
+    auto stop = high_resolution_clock::now();
+    double seconds = duration_cast<nanoseconds>(stop - start).count() / 1e9;
+    return bytes * repeats / seconds / 1e9;
+}
+
+// Unsorted scans (first match, count, all matches, bitmap) against read bandwidth
+void runScanBenchmark(long long maxBytes, int threads) {
+    double ghz = cyclesPerNs();
+    cout << "Linear scan of unsorted int columns (GB/s), " << simdKernelName() << " kernels, threads: "
+         << threads << endl;
+    if (ghz > 0) cout << "Bytes per cycle at the " << fixed << setprecision(2) << ghz << " GHz time stamp counter" << endl;
+    cout << endl;
+    cout << setw(10) << "Column" << setw(10) << "Read" << setw(10) << "Linear" << setw(10) << "SIMD"
+         << setw(10) << "B/cycle" << setw(10) << "Threads" << setw(10) << "Count" << setw(10)
+         << "FindAll" << setw(10) << "Bitmap" << endl;
+    cout << string(90, '-') << endl;
+
+    const int absent = 1000;   // never in the column: find scans everything
+    const int present = 7;
+    volatile long long sink = 0;
+    for (long long size = 4096; size * (long long)sizeof(int) <= maxBytes; size *= 4) {
+        vector<int> column = generateColumn((int)size);
+        const int* data = column.data();
+        int n = (int)size;
+        long long bytes = size * sizeof(int);
+
+        // Results first: the scans must agree with linearSearch
+        vector<int> positions;
+        vector<uint64_t> bitmap((n + 63) / 64);
+        int first = linearSearch(column, present);
+        long long matches = count(column.begin(), column.end(), present);
+        bool correct = findFirst(data, n, present) == first && findFirstParallel(data, n, present, threads) == first &&
+                       findFirst(data, n, absent) == -1 && findFirstParallel(data, n, absent, threads) == -1 &&
+                       countEqual(data, n, present) == matches && findAll(data, n, present, positions) == matches;
+        matchBitmap(data, n, present, bitmap.data());
+        for (int position : positions) {
+            if (!((bitmap[position / 64] >> (position % 64)) & 1)) correct = false;
+        }
+
+        double read = measureScanGBs([&]() { sink += xorReduce(data, n); }, bytes);
+        double linear = measureScanGBs([&]() { sink += linearSearch(column, absent); }, bytes);
+        double simd = measureScanGBs([&]() { sink += findFirst(data, n, absent); }, bytes);
+        double parallel = measureScanGBs([&]() { sink += findFirstParallel(data, n, absent, threads); }, bytes);
+        double counted = measureScanGBs([&]() { sink += countEqual(data, n, present); }, bytes);
+        double all = measureScanGBs([&]() {
+            positions.clear();
+            sink += findAll(data, n, present, positions);
+        }, bytes);
+        double bits = measureScanGBs([&]() { matchBitmap(data, n, present, bitmap.data()); }, bytes);
+
+        cout << setw(10) << formatBytes(bytes) << fixed << setprecision(1) << setw(10) << read << setw(10)
+             << linear << setw(10) << simd;
+        if (ghz > 0) {
+            cout << setw(10) << setprecision(2) << simd / ghz << setprecision(1);
+        } else {
+            cout << setw(10) << "-";
+        }
+        cout << setw(10) << parallel << setw(10) << counted << setw(10) << all << setw(10) << bits
+             << (correct ? "" : "  (wrong result!)") << endl;
+    }
+
+    cout << "\nRead: XOR of the whole column, the memory bandwidth a scan can reach" << endl;
+    cout << "Linear: linearSearch, one compare per element; SIMD: findFirst, 32 ints per iteration" << endl;
+    cout << "Threads: findFirst over " << SCAN_CHUNK / 1024 << "K-int chunks, first-match order kept" << endl;
+    cout << "Find scans use a missing value; Count/FindAll/Bitmap a value in ~0.1% of rows" << endl;
+}
+
+void printUsage(const char* program) {
+    cout << "Usage:" << endl;
+    cout << "  " << program << " [maxMB] [queries]" << endl;
+    cout << "      Binary search variants, array sizes 4 KB .. maxMB (default: 256 MB, 1000000 queries)" << endl;
+    cout << "  " << program << " --eytzinger [maxMB] [queries]" << endl;
+    cout << "      Eytzinger-layout index: build time, memory overhead and query speed" << endl;
+    cout << "  " << program << " --stree [maxMB] [queries]" << endl;
+    cout << "      Static B+-tree with 16-key nodes (AVX2 node search when the CPU supports it)" << endl;
+    cout << "  " << program << " --scan [maxMB] [threads]" << endl;
+    cout << "      Linear scans of unsorted columns: SIMD, threaded, count, find-all, bitmap" << endl;
+    cout << "  " << program << " --learned [maxMB] [queries]" << endl;
+    cout << "      Learned index (piecewise-linear model) on sequential, timestamp and lognormal keys" << endl;
+    cout << "  " << program << " --make-keys <file> <count> [uniform|timestamps]" << endl;
+    cout << "      Write a sorted binary key file (32-bit ints)" << endl;
+    cout << "  " << program << " --mapped <file> [queries] [uniform|recent]" << endl;
+    cout << "      Search a sorted key file in place (mmap): time and page faults per lookup" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    cout << "========================================" << endl;
+    cout << "Search Algorithms Comparison Tool" << endl;
+    cout << "========================================\n" << endl;
+
+    if (argc > 3 && string(argv[1]) == "--make-keys") {
+        string shape = (argc > 4) ? argv[4] : "uniform";
+        long long count = atoll(argv[3]);
+        if (!generateSortedKeyFile(argv[2], count, shape, inputSeed)) {
+            cout << "Error: cannot write " << argv[2] << endl;
+            return 1;
+        }
+        cout << "Wrote " << count << " sorted " << shape << " keys to " << argv[2] << endl;
+        return 0;
+    }
+    if (argc > 2 && string(argv[1]) == "--mapped") {
+        int queries = (argc > 3) ? atoi(argv[3]) : 10000;
+        string mix = (argc > 4) ? argv[4] : "uniform";
+        runMappedSearch(argv[2], max(queries, 1), mix);
+        return 0;
+    }
+
+    int first = 1;
+    string mode = "binary";
+    if (argc > 1 && argv[1][0] == '-') {
+        string option = argv[1];
+        mode = option.size() > 2 ? option.substr(2) : "";
+        first = 2;
+        if (mode != "eytzinger" && mode != "stree" && mode != "scan" && mode != "learned") {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    long long maxMB = (argc > first) ? atoll(argv[first]) : 256;
+    long long limitBytes = (mode == "eytzinger" || mode == "stree") ? EYTZINGER_MAX_BYTES : SEARCH_MAX_BYTES;
+    if (maxMB > limitBytes / (1024 * 1024)) {
+        maxMB = limitBytes / (1024 * 1024);
+        cout << "Note: arrays limited to " << maxMB << " MB in this mode\n" << endl;
+    }
+    long long maxBytes = max(maxMB, 1LL) * 1024 * 1024;
+    if (mode == "scan") {
+        int threads = (argc > first + 1) ? atoi(argv[first + 1]) : (int)thread::hardware_concurrency();
+        runScanBenchmark(maxBytes, max(threads, 1));
+        return 0;
+    }
+
+    int queries = (argc > first + 1) ? atoi(argv[first + 1]) : 1000000;
+    if (mode == "eytzinger") {
+        runEytzingerBenchmark(maxBytes, max(queries, 1));
+    } else if (mode == "stree") {
+        runStaticBTreeBenchmark(maxBytes, max(queries, 1));
+    } else if (mode == "learned") {
+        runLearnedIndexBenchmark(maxBytes, max(queries, 1));
+    } else {
+        runBinarySearchBenchmark(maxBytes, max(queries, 1));
+    }
+    return 0;
+}
@@ -0,0 +1,362 @@
+/*
+ * Searching Sorted Key Files in Place (mmap)
+ *
+ * Key files are raw binary arrays of sorted 32-bit ints (native byte order),
+ * the format written by the sorting tool's --external mode. MappedKeyFile
+ * maps a file read-only and exposes it as a const int*; nothing is read
+ * until a search touches a page, so opening a file of any size is instant.
+ * MADV_RANDOM turns off read-ahead, but page faults still undercount the
+ * pages a search reads: on Linux one fault maps the neighbouring cached
+ * pages too (fault-around, large folios). The searches are therefore
+ * templates over the key accessor, and PageTrace, an accessor that records
+ * every page it reads, counts the distinct pages of each lookup.
+ *
+ * Searches over a mapped array (positions are long long: files can hold
+ * more than 2^31 keys). All return the lower bound, the first position
+ * with data[i] >= target, or n:
+ *   - interpolationSearch: probes where the target should be if the keys
+ *     are evenly spread, then gallops away from the probe to bracket the
+ *     target. On uniform keys the brackets shrink to a page within two or
+ *     three rounds; when a round fails to halve the range (skewed keys) the
+ *     rest is a plain bisection, so the worst case stays O(log n).
+ *   - gallopSearch: exponential search from a hint position, steps of
+ *     1, 2, 4, ... then a binary search inside the last step. From the end
+ *     of an append-only file, recent keys cost O(log distance).
+ *   - SparseKeyIndex: every stride-th key kept in memory. A lookup searches
+ *     the samples in memory, then a single stride of the file; with a
+ *     stride of one page that is one or two pages.
+ */
+
+#ifndef MAPPED_SEARCH_H
+#define MAPPED_SEARCH_H
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_SEARCH_POSIX 1
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define MAPPED_SEARCH_POSIX 0
+#endif
+
+// Keys per sparse index sample: one 4 KB page
+const int SPARSE_INDEX_STRIDE = 1024;
+
+class MappedKeyFile {
+public:
+    MappedKeyFile() : fd(-1), mapping(nullptr), bytes(0) {}
+
+    ~MappedKeyFile() {
+        close();
+    }
+
+    MappedKeyFile(const MappedKeyFile&) = delete;
+    MappedKeyFile& operator=(const MappedKeyFile&) = delete;
+
+#if MAPPED_SEARCH_POSIX
+    // Map path read-only; false (see lastError) on failure
+    bool open(const std::string& path) {
+        close();
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return fail("open " + path);
+
+        struct stat info;
+        if (fstat(fd, &info) != 0) return fail("stat " + path);
+        bytes = (long long)info.st_size;
+        if (bytes % (long long)sizeof(int) != 0) {
+            error = path + ": size is not a multiple of 4 bytes";
+            close();
+            return false;
+        }
+        if (bytes == 0) return true;
+
+        mapping = mmap(nullptr, (size_t)bytes, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED) {
+            mapping = nullptr;
+            return fail("mmap " + path);
+        }
+        madvise(mapping, (size_t)bytes, MADV_RANDOM);
+        return true;
+    }
+
+    void close() {
+        if (mapping) munmap(mapping, (size_t)bytes);
+        if (fd >= 0) ::close(fd);
+        mapping = nullptr;
+        fd = -1;
+        bytes = 0;
+    }
+
+    // Ask the kernel to drop the file from the page cache (best effort), so
+    // the next searches read from disk; dirty pages of a file just written
+    // are not dropped, so they are flushed first
+    void evictFromCache() const {
+        if (fd < 0) return;
+#if defined(POSIX_FADV_DONTNEED)
+        fsync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    }
+#else
+    bool open(const std::string& path) {
+        error = path + ": memory-mapped files need a POSIX system";
+        return false;
+    }
+
+    void close() {}
+    void evictFromCache() const {}
+#endif
+
+    const int* data() const {
+        return (const int*)mapping;
+    }
+
+    long long size() const {
+        return bytes / (long long)sizeof(int);
+    }
+
+    const std::string& lastError() const {
+        return error;
+    }
+
+private:
+#if MAPPED_SEARCH_POSIX
+    bool fail(const std::string& what) {
+        error = what + ": " + std::strerror(errno);
+        close();
+        return false;
+    }
+#endif
+
+    int fd;
+    void* mapping;
+    long long bytes;
+    std::string error;
+};
+
+// Size of a virtual memory page in bytes
+inline long long systemPageBytes() {
+#if MAPPED_SEARCH_POSIX
+    long pageBytes = sysconf(_SC_PAGESIZE);
+    if (pageBytes > 0) return pageBytes;
+#endif
+    return 4096;
+}
+
+// Key accessor for the searches below that records the page of every key
+// read, for counting pages (not for timing: each read appends to a vector)
+class PageTrace {
+public:
+    explicit PageTrace(const int* keys) : data(keys), pageBytes((uintptr_t)systemPageBytes()) {}
+
+    int operator[](long long i) const {
+        pages.push_back((uintptr_t)(data + i) / pageBytes);
+        return data[i];
+    }
+
+    // Distinct pages read since the last call
+    long long takeDistinctPages() {
+        std::sort(pages.begin(), pages.end());
+        long long distinct = std::unique(pages.begin(), pages.end()) - pages.begin();
+        pages.clear();
+        return distinct;
+    }
+
+private:
+    const int* data;
+    uintptr_t pageBytes;
+    mutable std::vector<uintptr_t> pages;
+};
+
+// Page faults of this process so far (minor + major, or major only), -1 if unknown
+inline long long processPageFaults(bool majorOnly) {
+#if MAPPED_SEARCH_POSIX
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+    return majorOnly ? (long long)usage.ru_majflt : (long long)(usage.ru_minflt + usage.ru_majflt);
+#else
+    (void)majorOnly;
+    return -1;
+#endif
+}
+
+// Keys is const int* or PageTrace
+// Lower bound in data[low, high) by bisection
+template <typename Keys>
+inline long long bisectLowerBound(const Keys& data, long long low, long long high, int target) {
+    while (low < high) {
+        long long mid = low + (high - low) / 2;
+        if (data[mid] < target) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+template <typename Keys>
+inline long long interpolationSearch(const Keys& data, long long n, int target) {
+    long long low = 0, high = n;   // answer in [low, high]
+    while (high - low > 8) {
+        long long last = high - 1;
+        if (data[low] >= target) return low;
+        if (data[last] < target) return high;
+
+        // data[low] < target <= data[last]: the probe lands in (low, last]
+        double fraction = ((double)target - data[low]) / ((double)data[last] - data[low]);
+        long long probe = low + 1 + (long long)(fraction * (last - low - 1));
+        probe = std::min(probe, last);
+
+        // Bracket the answer with steps of 1, 2, 4, ... away from the probe;
+        // a good guess gives a small bracket on the same page
+        long long before = high - low;
+        long long step = 1;
+        if (data[probe] < target) {
+            low = probe + 1;
+            while (probe + step < high && data[probe + step] < target) {
+                low = probe + step + 1;
+                step *= 2;
+            }
+            high = std::min(high, probe + step);
+        } else {
+            high = probe;
+            while (probe - step > low && data[probe - step] >= target) {
+                high = probe - step;
+                step *= 2;
+            }
+            if (probe - step > low) low = probe - step + 1;
+        }
+
+        // Poor guess (skewed keys): plain bisection keeps the worst case O(log n)
+        if (high - low > before / 2) break;
+    }
+    return bisectLowerBound(data, low, high, target);
+}
+
+// Exponential search outwards from hint (0 = from the start, n - 1 = from the end)
+template <typename Keys>
+inline long long gallopSearch(const Keys& data, long long n, int target, long long hint) {
+    if (n == 0) return 0;
+    hint = std::max(0LL, std::min(hint, n - 1));
+    long long low, high;   // answer in [low, high]
+    if (data[hint] < target) {
+        long long step = 1;
+        low = hint + 1;
+        high = hint + 1;
+        while (high < n && data[high] < target) {
+            low = high + 1;
+            high = hint + 1 + step;
+            step *= 2;
+        }
+        high = std::min(high, n);
+    } else {
+        long long step = 1;
+        high = hint;
+        low = hint;
+        while (low > 0 && data[low - 1] >= target) {
+            high = low - 1;
+            low = std::max(0LL, hint - step);
+            step *= 2;
+        }
+    }
+    return bisectLowerBound(data, low, high, target);
+}
+
+// Write count sorted ints to path (test input for the mapped searches):
+//   "uniform":    random gaps spread evenly over the int range
+//   "timestamps": exponential gaps (mean 8) with a daily rate cycle, from 0;
+//                 counts that would pass INT_MAX start at INT_MIN with the mean
+//                 gap shrunk to fit (10% headroom for the random walk)
+inline bool generateSortedKeyFile(const std::string& path, long long count, const std::string& shape,
+                                  unsigned int seed) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    std::vector<int> block(1 << 20);
+    unsigned int state = seed ? seed : 1;
+    double averageGap = std::max(1.0, 4294967295.0 / (double)std::max(count, 1LL));
+    double timestampGap = 8;
+    double key = (double)INT_MIN;
+    if (shape == "timestamps") {
+        if (timestampGap * 1.1 * (double)count < (double)INT_MAX) {
+            key = 0;
+        } else {
+            timestampGap = 0.9 * 4294967295.0 / (double)count;
+        }
+    }
+    bool ok = true;
+    for (long long written = 0; written < count && ok; ) {
+        size_t n = (size_t)std::min((long long)block.size(), count - written);
+        for (size_t i = 0; i < n; i++) {
+            block[i] = (int)std::min(key, (double)INT_MAX);
+            // xorshift32, mapped to (0, 1]
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            double random = (state + 1.0) / 4294967296.0;
+            if (shape == "timestamps") {
+                double rate = 1.0 + 0.75 * std::sin(key * 2 * 3.14159265358979 / 86400);
+                key += timestampGap * -std::log(random) / rate;
+            } else {
+                key += std::floor(2 * averageGap * random);
+            }
+        }
+        ok = std::fwrite(block.data(), sizeof(int), n, file) == n;
+        written += n;
+    }
+    return std::fclose(file) == 0 && ok;
+}
+
+class SparseKeyIndex {
+public:
+    // Reads one key per stride (touches every stride-th key of data)
+    SparseKeyIndex(const int* keys, long long count, int keysPerSample = SPARSE_INDEX_STRIDE)
+        : data(keys), n(count), stride(std::max(keysPerSample, 1)) {
+        for (long long i = 0; i < n; i += stride) samples.push_back(data[i]);
+    }
+
+    // Search a new mapping of the same keys (the samples stay valid)
+    void attach(const int* keys) {
+        data = keys;
+    }
+
+    long long memoryBytes() const {
+        return (long long)samples.size() * sizeof(int);
+    }
+
+    long long lowerBound(int target) const {
+        return lowerBound(data, target);
+    }
+
+    // Same, reading the file through keys (a PageTrace over the same mapping)
+    template <typename Keys>
+    long long lowerBound(const Keys& keys, int target) const {
+        // Last sample < target: the answer is in (its position, next sample position]
+        long long block = std::lower_bound(samples.begin(), samples.end(), target) - samples.begin() - 1;
+        if (block < 0) return 0;
+        long long low = block * stride + 1;
+        long long high = std::min(low - 1 + stride, n);
+        return bisectLowerBound(keys, low, high, target);
+    }
+
+private:
+    const int* data;
+    long long n;
+    int stride;
+    std::vector<int> samples;
+};
+
+#endif
@@ -0,0 +1,50 @@
+/*
+ * AVX2 Support for the Search Kernels
+ *
+ * SIMD kernels are compiled with a function-level target attribute
+ * (SEARCH_AVX2), so the program itself needs no -mavx2 flag. The CPU is
+ * checked once at runtime and callers fall back to their scalar versions
+ * without AVX2 (or on non-GCC/Clang compilers).
+ *
+ * Shared search loops are written once as SEARCH_FORCE_INLINE templates
+ * over the kernel; an AVX2 entry point instantiates them inside its own
+ * target context so the kernel is inlined rather than called.
+ */
+
+#ifndef SIMD_SUPPORT_H
+#define SIMD_SUPPORT_H
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SEARCH_HAS_AVX2 1
+#include <immintrin.h>
+#define SEARCH_AVX2 __attribute__((target("avx2,popcnt")))
+#define SEARCH_FORCE_INLINE __attribute__((always_inline)) inline
+#else
+#define SEARCH_HAS_AVX2 0
+#define SEARCH_FORCE_INLINE inline
+#endif
+
+#if SEARCH_HAS_AVX2
+
+inline bool cpuHasAvx2() {
+    static const bool hasAvx2 = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0 && __builtin_cpu_supports("popcnt") != 0;
+    }();
+    return hasAvx2;
+}
+
+#else
+
+inline bool cpuHasAvx2() {
+    return false;
+}
+
+#endif
+
+// Name of the kernels selected for this CPU
+inline const char* simdKernelName() {
+    return cpuHasAvx2() ? "AVX2" : "scalar";
+}
+
+#endif
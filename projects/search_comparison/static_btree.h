@@ -0,0 +1,195 @@
+/*
+ * Static B+-tree (S-tree) Index
+ *
+ * An implicit B+-tree over a sorted int array. No pointers are stored:
+ * every node is one 64-byte cache line of 16 keys, and node k of a layer
+ * has children 17k .. 17k + 16 in the layer below. A lookup touches one
+ * cache line per layer, so 10^8 keys need 7 node loads instead of the ~27
+ * scattered probes of binary search.
+ *
+ *     leaves:   the sorted array itself, padded with INT_MAX to 16 per node
+ *     internal: key i of node k = smallest key of child 17k + i + 1
+ *
+ * Inside a node the search counts the keys < target. On CPUs with AVX2 the
+ * 16 keys are compared in two 8-lane registers and the count comes from a
+ * movemask (selected at runtime, see simd_support.h); otherwise a scalar
+ * loop with no data-dependent branch is used.
+ *
+ * Leaves are laid out in sorted order, so the leaf count is directly the
+ * lower bound position in the original array:
+ *     lowerBound(target): first position with sorted[i] >= target, or n
+ *     find(target):       a position holding target, or -1 (same as
+ *                         binarySearchIterative)
+ *
+ * Layers are stored root first in one cache-line-aligned block.
+ */
+
+#ifndef STATIC_BTREE_H
+#define STATIC_BTREE_H
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include "branchless_search.h"
+#include "simd_support.h"
+
+// Keys per node (one cache line) and children per internal node
+const int BTREE_NODE_KEYS = 16;
+const int BTREE_FANOUT = BTREE_NODE_KEYS + 1;
+
+class StaticBTree {
+public:
+    explicit StaticBTree(const std::vector<int>& sorted) : n((int)sorted.size()), useAvx2(cpuHasAvx2()) {
+        // Node count per layer, leaves first
+        std::vector<long long> nodes;
+        long long count = (n + BTREE_NODE_KEYS - 1) / BTREE_NODE_KEYS;
+        while (count > 0) {
+            nodes.push_back(count);
+            if (count == 1) break;
+            count = (count + BTREE_FANOUT - 1) / BTREE_FANOUT;
+        }
+        layers = (int)nodes.size();
+
+        // Offsets in ints, root layer first
+        offsets.assign(std::max(layers, 1), 0);
+        long long total = 0;
+        for (int h = layers - 1; h >= 0; h--) {
+            offsets[h] = total;
+            total += nodes[h] * BTREE_NODE_KEYS;
+        }
+
+        storage.assign(total + BTREE_NODE_KEYS, INT_MAX);
+        uintptr_t address = (uintptr_t)storage.data();
+        tree = storage.data() + ((64 - address % 64) % 64) / sizeof(int);
+
+        leaves = tree + offsets[0];
+        std::copy(sorted.begin(), sorted.end(), leaves);
+        long long leavesPerChild = 1;   // leaf nodes under one node of layer h - 1
+        for (int h = 1; h < layers; h++) {
+            int* layer = tree + offsets[h];
+            for (long long k = 0; k < nodes[h]; k++) {
+                for (int i = 0; i < BTREE_NODE_KEYS; i++) {
+                    long long first = (k * BTREE_FANOUT + i + 1) * leavesPerChild * BTREE_NODE_KEYS;
+                    layer[k * BTREE_NODE_KEYS + i] = first < n ? sorted[first] : INT_MAX;
+                }
+            }
+            leavesPerChild *= BTREE_FANOUT;
+        }
+    }
+
+    StaticBTree(const StaticBTree&) = delete;
+    StaticBTree& operator=(const StaticBTree&) = delete;
+
+    int size() const {
+        return n;
+    }
+
+    int height() const {
+        return layers;
+    }
+
+    // Bytes used by the index, including the copy of the keys in the leaves
+    long long memoryBytes() const {
+        return (long long)storage.size() * sizeof(int);
+    }
+
+    // First position in the sorted array with value >= target, n if none
+    int lowerBound(int target) const {
+        if (n == 0) return 0;
+#if SEARCH_HAS_AVX2
+        if (useAvx2) return lowerBoundAvx2(target);
+#endif
+        return lowerBoundWith<countLessScalar>(target);
+    }
+
+    // Position of target in the sorted array, -1 if absent
+    int find(int target) const {
+        int position = lowerBound(target);
+        return (position < n && leaves[position] == target) ? position : -1;
+    }
+
+    // results[i] = lowerBound(queries[i]), SEARCH_BATCH_SIZE queries in lockstep
+    void lowerBoundBatch(const int* queries, int count, int* results) const {
+        if (n == 0) {
+            std::fill(results, results + count, 0);
+            return;
+        }
+#if SEARCH_HAS_AVX2
+        if (useAvx2) {
+            lowerBoundBatchAvx2(queries, count, results);
+            return;
+        }
+#endif
+        lowerBoundBatchWith<countLessScalar>(queries, count, results);
+    }
+
+private:
+    // Number of the 16 keys of a node that are < target
+    static int countLessScalar(const int* node, int target) {
+        int count = 0;
+        for (int i = 0; i < BTREE_NODE_KEYS; i++) count += node[i] < target;
+        return count;
+    }
+
+    template <int (*CountLess)(const int*, int)>
+    SEARCH_FORCE_INLINE int lowerBoundWith(int target) const {
+        long long k = 0;
+        for (int h = layers - 1; h > 0; h--) {
+            k = k * BTREE_FANOUT + CountLess(tree + offsets[h] + k * BTREE_NODE_KEYS, target);
+        }
+        long long position = k * BTREE_NODE_KEYS + CountLess(leaves + k * BTREE_NODE_KEYS, target);
+        return position < n ? (int)position : n;
+    }
+
+    template <int (*CountLess)(const int*, int)>
+    SEARCH_FORCE_INLINE void lowerBoundBatchWith(const int* queries, int count, int* results) const {
+        long long k[SEARCH_BATCH_SIZE];
+        for (int start = 0; start < count; start += SEARCH_BATCH_SIZE) {
+            int group = std::min(SEARCH_BATCH_SIZE, count - start);
+            const int* q = queries + start;
+            for (int g = 0; g < group; g++) k[g] = 0;
+            for (int h = layers - 1; h > 0; h--) {
+                const int* layer = tree + offsets[h];
+                const int* below = tree + offsets[h - 1];
+                for (int g = 0; g < group; g++) {
+                    k[g] = k[g] * BTREE_FANOUT + CountLess(layer + k[g] * BTREE_NODE_KEYS, q[g]);
+                    SEARCH_PREFETCH(below + k[g] * BTREE_NODE_KEYS);
+                }
+            }
+            for (int g = 0; g < group; g++) {
+                long long position = k[g] * BTREE_NODE_KEYS + CountLess(leaves + k[g] * BTREE_NODE_KEYS, q[g]);
+                results[start + g] = position < n ? (int)position : n;
+            }
+        }
+    }
+
+#if SEARCH_HAS_AVX2
+    // 16 keys = two 8-lane compares; the movemask bits of the keys < target are counted
+    SEARCH_AVX2 static int countLessAvx2(const int* node, int target) {
+        __m256i key = _mm256_set1_epi32(target);
+        __m256i low = _mm256_cmpgt_epi32(key, _mm256_load_si256((const __m256i*)node));
+        __m256i high = _mm256_cmpgt_epi32(key, _mm256_load_si256((const __m256i*)(node + 8)));
+        unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(low)) |
+                            ((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(high)) << 8);
+        return __builtin_popcount(mask);
+    }
+
+    SEARCH_AVX2 int lowerBoundAvx2(int target) const {
+        return lowerBoundWith<countLessAvx2>(target);
+    }
+
+    SEARCH_AVX2 void lowerBoundBatchAvx2(const int* queries, int count, int* results) const {
+        lowerBoundBatchWith<countLessAvx2>(queries, count, results);
+    }
+#endif
+
+    int n;
+    bool useAvx2;
+    int layers;
+    std::vector<long long> offsets;   // offsets[h]: first int of layer h (layer 0 = leaves)
+    std::vector<int> storage;
+    int* tree;
+    int* leaves;
+};
+
+#endif
@@ -0,0 +1,387 @@
+/*
+ * Benchmark Support for the Sorting Comparison Tool
+ *
+ * - Seeded input generators for several distributions
+ * - Summary statistics over repeated trials (min, median, p95, mean)
+ * - CSV / JSON result files (raw samples included), read back for --compare
+ * - Comparison of two result files with a Mann-Whitney U test, so that
+ *   only statistically significant changes are reported
+ * - Scaling sweep results (size, strong and weak scaling) as long-format
+ *   CSV, one row per point, ready for plotting
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <climits>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Input distributions understood by generateInput()
+inline const std::vector<std::string>& inputDistributions() {
+    static const std::vector<std::string> names = {
+        "random", "sorted", "reversed", "few-unique", "organ-pipe", "zipf"
+    };
+    return names;
+}
+
+inline bool isInputDistribution(const std::string& name) {
+    const std::vector<std::string>& names = inputDistributions();
+    return std::find(names.begin(), names.end(), name) != names.end();
+}
+
+// Deterministic input of the given distribution (same seed -> same array)
+inline std::vector<int> generateInput(const std::string& distribution, int size, unsigned int seed) {
+    std::vector<int> arr(size);
+    std::mt19937 gen(seed);
+
+    if (distribution == "few-unique") {
+        std::uniform_int_distribution<int> dis(0, 15);
+        for (int& value : arr) value = dis(gen);
+    } else if (distribution == "zipf") {
+        // Zipf (s = 1) over up to 100000 ranks: rank r has weight 1 / r
+        int ranks = std::max(1, std::min(size, 100000));
+        std::vector<double> cdf(ranks);
+        double sum = 0;
+        for (int r = 0; r < ranks; r++) {
+            sum += 1.0 / (r + 1);
+            cdf[r] = sum;
+        }
+        std::uniform_real_distribution<double> dis(0.0, sum);
+        for (int& value : arr) {
+            value = (int)(std::upper_bound(cdf.begin(), cdf.end(), dis(gen)) - cdf.begin());
+            value = std::min(value, ranks - 1);
+        }
+    } else {
+        std::uniform_int_distribution<int> dis(INT_MIN, INT_MAX);
+        for (int& value : arr) value = dis(gen);
+
+        if (distribution == "sorted") {
+            std::sort(arr.begin(), arr.end());
+        } else if (distribution == "reversed") {
+            std::sort(arr.rbegin(), arr.rend());
+        } else if (distribution == "organ-pipe") {
+            // Ascending first half, descending second half
+            std::sort(arr.begin(), arr.begin() + size / 2);
+            std::sort(arr.begin() + size / 2, arr.end(), [](int a, int b) { return a > b; });
+        }
+    }
+    return arr;
+}
+
+struct BenchResult {
+    std::string algorithm;
+    std::string distribution;
+    long long size = 0;
+    unsigned int seed = 0;
+    std::vector<double> samplesNs;   // One entry per measured trial
+
+    double minNs = 0, medianNs = 0, p95Ns = 0, meanNs = 0;
+
+    double elementsPerSecond() const {
+        return medianNs > 0 ? size * 1e9 / medianNs : 0;
+    }
+};
+
+// Nearest-rank percentile of sorted samples, p in [0, 100]
+inline double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    int rank = (int)std::ceil(p / 100.0 * sorted.size());
+    return sorted[std::max(0, std::min(rank - 1, (int)sorted.size() - 1))];
+}
+
+inline void computeStats(BenchResult& result) {
+    std::vector<double> sorted = result.samplesNs;
+    std::sort(sorted.begin(), sorted.end());
+    if (sorted.empty()) return;
+
+    result.minNs = sorted.front();
+    size_t n = sorted.size();
+    result.medianNs = (n % 2 == 1) ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    result.p95Ns = percentile(sorted, 95);
+    double sum = 0;
+    for (double sample : sorted) sum += sample;
+    result.meanNs = sum / n;
+}
+
+inline void writeCsv(std::ostream& out, const std::vector<BenchResult>& results) {
+    out << "algorithm,distribution,size,seed,trials,min_ns,median_ns,p95_ns,mean_ns,"
+           "elements_per_sec,samples_ns\n";
+    out << std::fixed << std::setprecision(0);
+    for (const BenchResult& r : results) {
+        out << r.algorithm << "," << r.distribution << "," << r.size << "," << r.seed << ","
+            << r.samplesNs.size() << "," << r.minNs << "," << r.medianNs << "," << r.p95Ns << ","
+            << r.meanNs << "," << r.elementsPerSecond() << ",";
+        for (size_t i = 0; i < r.samplesNs.size(); i++) {
+            out << (i ? ";" : "") << r.samplesNs[i];
+        }
+        out << "\n";
+    }
+}
+
+inline void writeJson(std::ostream& out, const std::vector<BenchResult>& results) {
+    out << std::fixed << std::setprecision(0);
+    out << "[\n";
+    for (size_t k = 0; k < results.size(); k++) {
+        const BenchResult& r = results[k];
+        out << "  {\"algorithm\": \"" << r.algorithm << "\", \"distribution\": \"" << r.distribution
+            << "\", \"size\": " << r.size << ", \"seed\": " << r.seed
+            << ", \"trials\": " << r.samplesNs.size()
+            << ", \"min_ns\": " << r.minNs << ", \"median_ns\": " << r.medianNs
+            << ", \"p95_ns\": " << r.p95Ns << ", \"mean_ns\": " << r.meanNs
+            << ", \"elements_per_sec\": " << r.elementsPerSecond() << ", \"samples_ns\": [";
+        for (size_t i = 0; i < r.samplesNs.size(); i++) {
+            out << (i ? ", " : "") << r.samplesNs[i];
+        }
+        out << "]}" << (k + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+// One point of a scaling sweep
+// mode "size":   one thread, growing size
+// mode "strong": fixed size, speedup = T(1 thread) / T(threads)
+// mode "weak":   size grows with the threads, efficiency = T(1, n) / T(threads, threads * n)
+struct SweepResult {
+    std::string mode;
+    BenchResult bench;
+    int threads = 1;
+    double speedup = 1;
+    double efficiency = 1;
+};
+
+inline void writeSweepCsv(std::ostream& out, const std::vector<SweepResult>& results) {
+    out << "mode,algorithm,distribution,size,threads,trials,min_ns,median_ns,p95_ns,"
+           "elements_per_sec,speedup,efficiency\n";
+    for (const SweepResult& r : results) {
+        const BenchResult& b = r.bench;
+        out << std::fixed << std::setprecision(0)
+            << r.mode << "," << b.algorithm << "," << b.distribution << "," << b.size << ","
+            << r.threads << "," << b.samplesNs.size() << "," << b.minNs << "," << b.medianNs << ","
+            << b.p95Ns << "," << b.elementsPerSecond() << ","
+            << std::setprecision(3) << r.speedup << "," << r.efficiency << "\n";
+    }
+}
+
+// Read a file written by writeCsv; returns false if it cannot be parsed
+inline bool readCsv(const std::string& path, std::vector<BenchResult>& results) {
+    std::ifstream in(path);
+    std::string line;
+    if (!in || !std::getline(in, line)) return false;
+
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        std::vector<std::string> fields;
+        std::stringstream row(line);
+        std::string field;
+        while (std::getline(row, field, ',')) fields.push_back(field);
+        if (fields.size() < 11) return false;
+
+        BenchResult r;
+        r.algorithm = fields[0];
+        r.distribution = fields[1];
+        r.size = std::atoll(fields[2].c_str());
+        r.seed = (unsigned int)std::strtoul(fields[3].c_str(), nullptr, 10);
+        std::stringstream samples(fields[10]);
+        while (std::getline(samples, field, ';')) r.samplesNs.push_back(std::atof(field.c_str()));
+        computeStats(r);
+        results.push_back(r);
+    }
+    return true;
+}
+
+inline void skipJsonSpace(const std::string& text, size_t& pos) {
+    while (pos < text.size() && std::isspace((unsigned char)text[pos])) pos++;
+}
+
+// Reads a quoted string at pos (writeJson does not escape, so neither does this)
+inline bool readJsonString(const std::string& text, size_t& pos, std::string& value) {
+    skipJsonSpace(text, pos);
+    if (pos >= text.size() || text[pos] != '"') return false;
+    size_t end = text.find('"', pos + 1);
+    if (end == std::string::npos) return false;
+    value = text.substr(pos + 1, end - pos - 1);
+    pos = end + 1;
+    return true;
+}
+
+inline bool readJsonNumber(const std::string& text, size_t& pos, double& value) {
+    skipJsonSpace(text, pos);
+    const char* begin = text.c_str() + pos;
+    char* end = nullptr;
+    value = std::strtod(begin, &end);
+    if (end == begin) return false;
+    pos += end - begin;
+    return true;
+}
+
+// Read a file written by writeJson; returns false if it cannot be parsed
+inline bool readJson(const std::string& path, std::vector<BenchResult>& results) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string text = buffer.str();
+
+    size_t pos = 0;
+    skipJsonSpace(text, pos);
+    if (pos >= text.size() || text[pos++] != '[') return false;
+    skipJsonSpace(text, pos);
+    if (pos < text.size() && text[pos] == ']') return true;
+
+    while (true) {
+        skipJsonSpace(text, pos);
+        if (pos >= text.size() || text[pos++] != '{') return false;
+
+        BenchResult r;
+        while (true) {
+            std::string key;
+            if (!readJsonString(text, pos, key)) return false;
+            skipJsonSpace(text, pos);
+            if (pos >= text.size() || text[pos++] != ':') return false;
+            skipJsonSpace(text, pos);
+
+            double number = 0;
+            if (key == "algorithm" || key == "distribution") {
+                if (!readJsonString(text, pos, key == "algorithm" ? r.algorithm : r.distribution)) return false;
+            } else if (key == "samples_ns") {
+                if (pos >= text.size() || text[pos++] != '[') return false;
+                skipJsonSpace(text, pos);
+                while (pos < text.size() && text[pos] != ']') {
+                    if (!readJsonNumber(text, pos, number)) return false;
+                    r.samplesNs.push_back(number);
+                    skipJsonSpace(text, pos);
+                    if (pos < text.size() && text[pos] == ',') pos++;
+                }
+                if (pos++ >= text.size()) return false;
+            } else {
+                // The summary fields are recomputed from the samples
+                if (!readJsonNumber(text, pos, number)) return false;
+                if (key == "size") r.size = (long long)number;
+                if (key == "seed") r.seed = (unsigned int)number;
+            }
+
+            skipJsonSpace(text, pos);
+            if (pos >= text.size()) return false;
+            char separator = text[pos++];
+            if (separator == '}') break;
+            if (separator != ',') return false;
+        }
+        computeStats(r);
+        results.push_back(r);
+
+        skipJsonSpace(text, pos);
+        if (pos >= text.size()) return false;
+        char separator = text[pos++];
+        if (separator == ']') return true;
+        if (separator != ',') return false;
+    }
+}
+
+// Read a result file written as CSV or JSON (a JSON file starts with '[')
+inline bool readResults(const std::string& path, std::vector<BenchResult>& results) {
+    std::ifstream in(path);
+    char first = 0;
+    if (!(in >> first)) return false;
+    return first == '[' ? readJson(path, results) : readCsv(path, results);
+}
+
+// Two-sided p-value of the Mann-Whitney U test (normal approximation with
+// tie correction). Small p means the two sample sets differ in location.
+inline double mannWhitneyPValue(const std::vector<double>& a, const std::vector<double>& b) {
+    size_t n1 = a.size(), n2 = b.size();
+    if (n1 == 0 || n2 == 0) return 1.0;
+
+    std::vector<std::pair<double, int> > all;
+    for (double x : a) all.push_back(std::make_pair(x, 0));
+    for (double x : b) all.push_back(std::make_pair(x, 1));
+    std::sort(all.begin(), all.end());
+
+    // Average ranks for ties
+    double rankSumA = 0, tieTerm = 0;
+    size_t n = all.size();
+    for (size_t i = 0; i < n; ) {
+        size_t j = i;
+        while (j < n && all[j].first == all[i].first) j++;
+        double averageRank = (i + 1 + j) / 2.0;
+        for (size_t k = i; k < j; k++) {
+            if (all[k].second == 0) rankSumA += averageRank;
+        }
+        double t = (double)(j - i);
+        tieTerm += t * t * t - t;
+        i = j;
+    }
+
+    double u = rankSumA - n1 * (n1 + 1) / 2.0;
+    double meanU = n1 * n2 / 2.0;
+    double variance = n1 * n2 / 12.0 * ((n + 1) - tieTerm / (n * (n - 1.0)));
+    if (variance <= 0) return 1.0;
+
+    double z = (std::fabs(u - meanU) - 0.5) / std::sqrt(variance);  // Continuity correction
+    if (z < 0) z = 0;
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+// Report significant changes between two result files
+// Returns the number of significant regressions
+inline int compareResults(const std::vector<BenchResult>& baseline, const std::vector<BenchResult>& current,
+                          double alpha, double thresholdPercent) {
+    std::cout << std::setw(16) << "Algorithm" << std::setw(13) << "Input" << std::setw(12) << "Size"
+              << std::setw(14) << "Base (ms)" << std::setw(14) << "New (ms)" << std::setw(11) << "Change"
+              << std::setw(10) << "p-value" << "  Verdict" << std::endl;
+    std::cout << std::string(110, '-') << std::endl;
+
+    int regressions = 0, improvements = 0, matched = 0;
+    for (const BenchResult& cur : current) {
+        for (const BenchResult& base : baseline) {
+            if (base.algorithm != cur.algorithm || base.distribution != cur.distribution ||
+                base.size != cur.size) {
+                continue;
+            }
+            matched++;
+
+            // Without a positive baseline median there is no relative change to judge
+            if (base.medianNs <= 0) {
+                std::cout << std::setw(16) << cur.algorithm << std::setw(13) << cur.distribution
+                          << std::setw(12) << cur.size << std::fixed << std::setprecision(3)
+                          << std::setw(14) << base.medianNs / 1e6 << std::setw(14) << cur.medianNs / 1e6
+                          << std::setw(11) << "n/a" << std::setw(10) << "n/a" << "  no baseline" << std::endl;
+                break;
+            }
+
+            double change = (cur.medianNs - base.medianNs) / base.medianNs * 100.0;
+            double p = mannWhitneyPValue(base.samplesNs, cur.samplesNs);
+            std::string verdict = "no change";
+            if (p < alpha && std::fabs(change) >= thresholdPercent) {
+                verdict = (change > 0) ? "REGRESSION" : "improvement";
+                if (change > 0) regressions++;
+                else improvements++;
+            } else if (std::min(base.samplesNs.size(), cur.samplesNs.size()) < 5) {
+                verdict = "too few trials";
+            }
+
+            std::cout << std::setw(16) << cur.algorithm << std::setw(13) << cur.distribution
+                      << std::setw(12) << cur.size << std::fixed << std::setprecision(3)
+                      << std::setw(14) << base.medianNs / 1e6 << std::setw(14) << cur.medianNs / 1e6
+                      << std::setprecision(1) << std::setw(10) << change << "%"
+                      << std::setprecision(4) << std::setw(10) << p << "  " << verdict << std::endl;
+            break;
+        }
+    }
+
+    std::cout << std::defaultfloat << "\n" << matched << " matched results, " << regressions << " significant regressions, "
+              << improvements << " significant improvements (alpha = " << alpha
+              << ", threshold = " << thresholdPercent << "%)" << std::endl;
+    return regressions;
+}
+
+#endif
@@ -0,0 +1,423 @@
+/*
+ * External Merge Sort (datasets larger than RAM)
+ *
+ * Input/output files are raw binary arrays of 32-bit ints (native byte order).
+ *
+ * Phase 1 - Run formation:
+ *   The input is read in memory-sized chunks. Each chunk is sorted with an
+ *   in-memory engine and written to a temporary run file. Reading the next
+ *   chunk overlaps with sorting and writing the current one.
+ *
+ * Phase 2 - K-way merge:
+ *   Up to fanIn runs are merged at once with a loser tree (log2(k)
+ *   comparisons per element). Every run is read through a double-buffered
+ *   reader: the next block is read in the background while the current one
+ *   is merged. The output is written the same way. With more runs than
+ *   fanIn, several merge passes are made.
+ *
+ * I/O volume: 2 * N * (1 + merge passes) elements are moved through disk.
+ */
+
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <string>
+#include <vector>
+
+struct ExternalSortStats {
+    long long elements = 0;
+    long long bytesRead = 0;
+    long long bytesWritten = 0;
+    int runs = 0;
+    int fanIn = 0;
+    int mergePasses = 0;
+    double runFormationMs = 0;
+    double mergeMs = 0;
+};
+
+// Sequential reader with a background prefetch of the next block
+class PrefetchingReader {
+public:
+    PrefetchingReader(const std::string& path, size_t blockInts, long long& bytesRead)
+        : file(std::fopen(path.c_str(), "rb")), current(blockInts), next(blockInts),
+          position(0), available(0), bytesRead(bytesRead) {
+        if (file) {
+            pending = startRead();
+            refill();
+        }
+    }
+
+    ~PrefetchingReader() {
+        if (pending.valid()) pending.wait();
+        if (file) std::fclose(file);
+    }
+
+    bool isOpen() const {
+        return file != nullptr;
+    }
+
+    bool empty() const {
+        return position == available;
+    }
+
+    int peek() const {
+        return current[position];
+    }
+
+    // Advance to the next value; returns false at end of file
+    bool advance() {
+        position++;
+        if (position == available) refill();
+        return position < available;
+    }
+
+    // Fill out with up to out.size() values (used for run formation)
+    size_t readBlock(std::vector<int>& out) {
+        size_t count = 0;
+        while (count < out.size() && !empty()) {
+            size_t take = std::min(out.size() - count, available - position);
+            std::copy(current.begin() + position, current.begin() + position + take, out.begin() + count);
+            count += take;
+            position += take;
+            if (position == available) refill();
+        }
+        return count;
+    }
+
+private:
+    std::future<size_t> startRead() {
+        std::FILE* f = file;
+        int* target = next.data();
+        size_t capacity = next.size();
+        return std::async(std::launch::async, [f, target, capacity]() {
+            return std::fread(target, sizeof(int), capacity, f);
+        });
+    }
+
+    // Swap in the prefetched block and start reading the one after it
+    void refill() {
+        available = pending.get();
+        bytesRead += (long long)available * sizeof(int);
+        current.swap(next);
+        position = 0;
+        if (available > 0) pending = startRead();
+    }
+
+    std::FILE* file;
+    std::vector<int> current, next;
+    size_t position, available;
+    std::future<size_t> pending;
+    long long& bytesRead;
+};
+
+// Sequential writer; a full block is written in the background while the next fills
+class DoubleBufferedWriter {
+public:
+    DoubleBufferedWriter(const std::string& path, size_t blockInts, long long& bytesWritten)
+        : file(std::fopen(path.c_str(), "wb")), current(blockInts), next(blockInts),
+          position(0), bytesWritten(bytesWritten), failed(file == nullptr) {}
+
+    ~DoubleBufferedWriter() {
+        close();
+    }
+
+    bool isOpen() const {
+        return file != nullptr;
+    }
+
+    void push(int value) {
+        current[position++] = value;
+        if (position == current.size()) flushBlock();
+    }
+
+    void write(const int* data, size_t count) {
+        while (count > 0) {
+            size_t take = std::min(count, current.size() - position);
+            std::copy(data, data + take, current.begin() + position);
+            position += take;
+            data += take;
+            count -= take;
+            if (position == current.size()) flushBlock();
+        }
+    }
+
+    // Returns false if the file could not be opened or any write failed
+    bool close() {
+        if (!file) return !failed;
+        flushBlock();
+        waitPending();
+        if (std::fclose(file) != 0) failed = true;
+        file = nullptr;
+        return !failed;
+    }
+
+private:
+    void waitPending() {
+        if (pending.valid() && !pending.get()) failed = true;
+    }
+
+    void flushBlock() {
+        if (position == 0) return;
+        waitPending();
+        current.swap(next);
+        std::FILE* f = file;
+        const int* source = next.data();
+        size_t count = position;
+        bytesWritten += (long long)count * sizeof(int);
+        pending = std::async(std::launch::async, [f, source, count]() {
+            return std::fwrite(source, sizeof(int), count, f) == count;
+        });
+        position = 0;
+    }
+
+    std::FILE* file;
+    std::vector<int> current, next;
+    size_t position;
+    std::future<bool> pending;
+    long long& bytesWritten;
+    bool failed;
+};
+
+// Loser tree over k sorted runs: the overall winner is at losers[0],
+// and replacing it costs one leaf-to-root pass
+class LoserTree {
+public:
+    explicit LoserTree(std::vector<PrefetchingReader*>& sources)
+        : sources(sources), k((int)sources.size()), losers(std::max(k, 1)) {
+        std::vector<int> winners(2 * k);
+        for (int i = 0; i < k; i++) winners[k + i] = i;
+        for (int node = k - 1; node >= 1; node--) {
+            int a = winners[2 * node], b = winners[2 * node + 1];
+            if (beats(b, a)) std::swap(a, b);
+            winners[node] = a;
+            losers[node] = b;
+        }
+        losers[0] = (k > 1) ? winners[1] : 0;
+    }
+
+    // Source with the smallest current value, or -1 when all are exhausted
+    int winner() const {
+        return sources[losers[0]]->empty() ? -1 : losers[0];
+    }
+
+    // Advance the winning source and replay its path to the root
+    void advanceWinner() {
+        int source = losers[0];
+        sources[source]->advance();
+        for (int node = (source + k) / 2; node >= 1; node /= 2) {
+            if (beats(losers[node], source)) std::swap(losers[node], source);
+        }
+        losers[0] = source;
+    }
+
+private:
+    bool beats(int a, int b) const {
+        if (sources[a]->empty()) return false;
+        if (sources[b]->empty()) return true;
+        int va = sources[a]->peek(), vb = sources[b]->peek();
+        return va < vb || (va == vb && a < b);
+    }
+
+    std::vector<PrefetchingReader*>& sources;
+    int k;
+    std::vector<int> losers;
+};
+
+inline double elapsedMs(std::chrono::high_resolution_clock::time_point start) {
+    auto stop = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count() / 1000.0;
+}
+
+// Merge the given runs into outputPath; returns false on I/O errors
+inline bool mergeRunFiles(const std::vector<std::string>& runs, const std::string& outputPath,
+                          size_t blockInts, ExternalSortStats& stats) {
+    std::vector<PrefetchingReader*> readers;
+    bool ok = true;
+    for (const std::string& run : runs) {
+        readers.push_back(new PrefetchingReader(run, blockInts, stats.bytesRead));
+        if (!readers.back()->isOpen()) ok = false;
+    }
+
+    DoubleBufferedWriter writer(outputPath, blockInts, stats.bytesWritten);
+    if (ok && writer.isOpen()) {
+        LoserTree tree(readers);
+        for (int source = tree.winner(); source != -1; source = tree.winner()) {
+            writer.push(readers[source]->peek());
+            tree.advanceWinner();
+        }
+    }
+    ok = writer.close() && ok;
+
+    for (PrefetchingReader* reader : readers) delete reader;
+    return ok;
+}
+
+// Removes the temporary run files still listed when an external sort fails
+class RunFileCleanup {
+public:
+    RunFileCleanup(const std::vector<std::string>& runs, const std::vector<std::string>& merged)
+        : runs(runs), merged(merged), active(true) {}
+
+    RunFileCleanup(const RunFileCleanup&) = delete;
+    RunFileCleanup& operator=(const RunFileCleanup&) = delete;
+
+    ~RunFileCleanup() {
+        if (!active) return;
+        for (const std::string& run : runs) std::remove(run.c_str());
+        for (const std::string& run : merged) std::remove(run.c_str());
+    }
+
+    // The sort succeeded and consumed every run
+    void release() {
+        active = false;
+    }
+
+private:
+    const std::vector<std::string>& runs;
+    const std::vector<std::string>& merged;
+    bool active;
+};
+
+// Sort inputPath into outputPath using about memoryBytes of RAM
+// sortFunc is any in-memory engine with the vector<int>& interface
+// Returns false (and sets error) if a file cannot be read or written; the
+// temporary run files are removed either way
+inline bool externalSort(const std::string& inputPath, const std::string& outputPath,
+                         long long memoryBytes, int maxFanIn,
+                         void (*sortFunc)(std::vector<int>&),
+                         ExternalSortStats& stats, std::string& error) {
+    typedef std::chrono::high_resolution_clock Clock;
+    stats = ExternalSortStats();
+
+    // Run formation holds three chunks: one being read, one being sorted
+    // and the engine's scratch buffer
+    size_t chunkInts = (size_t)std::max(memoryBytes / (3 * (long long)sizeof(int)), 1024LL);
+    size_t readBlockInts = std::min(chunkInts, (size_t)1 << 20);
+
+    // Phase 1: sorted runs
+    auto start = Clock::now();
+    std::vector<std::string> runs, merged;
+    RunFileCleanup cleanup(runs, merged);
+    {
+        PrefetchingReader input(inputPath, readBlockInts, stats.bytesRead);
+        if (!input.isOpen()) {
+            error = "cannot open input file " + inputPath;
+            return false;
+        }
+
+        std::vector<int> chunk(chunkInts), nextChunk(chunkInts);
+        size_t count = input.readBlock(chunk);
+
+        while (count > 0) {
+            // Start reading the next chunk while this one is sorted and written
+            std::future<size_t> nextRead = std::async(std::launch::async, [&input, &nextChunk]() {
+                return input.readBlock(nextChunk);
+            });
+
+            chunk.resize(count);
+            sortFunc(chunk);
+            stats.elements += count;
+
+            std::string runPath = outputPath + ".run" + std::to_string(runs.size()) + ".tmp";
+            runs.push_back(runPath);
+            {
+                DoubleBufferedWriter writer(runPath, readBlockInts, stats.bytesWritten);
+                writer.write(chunk.data(), chunk.size());
+                if (!writer.close()) {
+                    nextRead.wait();
+                    error = "cannot write run file " + runPath;
+                    return false;
+                }
+            }
+
+            count = nextRead.get();
+            chunk.resize(chunkInts);
+            chunk.swap(nextChunk);
+        }
+    }
+    stats.runs = (int)runs.size();
+    stats.runFormationMs = elapsedMs(start);
+
+    // Phase 2: k-way merge passes
+    start = Clock::now();
+    if (runs.empty()) {
+        DoubleBufferedWriter writer(outputPath, 1, stats.bytesWritten);
+        if (!writer.close()) {
+            error = "cannot write output file " + outputPath;
+            return false;
+        }
+        cleanup.release();
+        return true;
+    }
+
+    // A single run is already the sorted output
+    if (runs.size() == 1) {
+        std::remove(outputPath.c_str());
+        if (std::rename(runs[0].c_str(), outputPath.c_str()) == 0) {
+            stats.mergeMs = elapsedMs(start);
+            cleanup.release();
+            return true;
+        }
+    }
+
+    int fanIn = std::max(2, maxFanIn);
+    stats.fanIn = std::min(fanIn, (int)runs.size());
+
+    // Each run has two blocks (current + prefetch), plus two for the output
+    size_t mergeBlockInts = (size_t)std::max(memoryBytes / (long long)sizeof(int) / (2 * fanIn + 2), 1024LL);
+
+    int nextTemp = (int)runs.size();
+    while (true) {
+        stats.mergePasses++;
+        bool finalPass = (int)runs.size() <= fanIn;
+        merged.clear();
+
+        for (size_t group = 0; group < runs.size(); group += fanIn) {
+            std::vector<std::string> inputs(runs.begin() + group,
+                                            runs.begin() + std::min(runs.size(), group + fanIn));
+            std::string target = finalPass ? outputPath
+                                           : outputPath + ".run" + std::to_string(nextTemp++) + ".tmp";
+            if (!finalPass) merged.push_back(target);
+            if (!mergeRunFiles(inputs, target, mergeBlockInts, stats)) {
+                error = "merge failed while writing " + target;
+                return false;
+            }
+            for (const std::string& run : inputs) std::remove(run.c_str());
+        }
+
+        if (finalPass) break;
+        runs.swap(merged);
+    }
+    stats.mergeMs = elapsedMs(start);
+    cleanup.release();
+    return true;
+}
+
+// Write count random ints to path (test input for externalSort)
+inline bool generateIntFile(const std::string& path, long long count, unsigned int seed) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    std::vector<int> block(1 << 20);
+    unsigned int state = seed ? seed : 1;
+    bool ok = true;
+    for (long long written = 0; written < count && ok; ) {
+        size_t n = (size_t)std::min((long long)block.size(), count - written);
+        for (size_t i = 0; i < n; i++) {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            block[i] = (int)state;
+        }
+        ok = std::fwrite(block.data(), sizeof(int), n, file) == n;
+        written += n;
+    }
+    return std::fclose(file) == 0 && ok;
+}
+
+#endif
@@ -0,0 +1,474 @@
+/*
+ * Generic Sorts over Random-Access Iterators
+ *
+ * The same engines as the vector<int> versions, written as templates so
+ * that the comparator and the key projection are template parameters and
+ * inline into the inner loops (no calls through function pointers):
+ *
+ *     insertionSortGeneric(first, last, comp, proj)
+ *     mergeSortGeneric(first, last, comp, proj)    - stable, bottom-up
+ *     quickSortGeneric(first, last, comp, proj)    - introsort
+ *     sortGeneric / stableSortGeneric(first, last, comp, proj)
+ *     argsortGeneric(first, last, comp, proj)      - permutation only
+ *     indirectSortGeneric(first, last, comp, proj) - argsort + one move per element
+ *
+ * proj(element) returns the key and comp(keyA, keyB) compares keys, so
+ *     sortGeneric(v.begin(), v.end(), LessThan(), [](const Event& e) { return e.timestamp; });
+ * sorts structs by one field. For heavy keys the projection should return
+ * a const reference (e.g. "-> const string&") to avoid copies.
+ *
+ * Compile-time fast paths for arithmetic keys:
+ * - sortGeneric / stableSortGeneric use an LSD radix sort (8-bit digits,
+ *   stable) when the key is an integer, float or double and the comparator
+ *   is LessThan. Elements much larger than their key are not moved by every
+ *   pass: (key, index) pairs are sorted and each element is moved once.
+ *   Other keys or comparators use introsort / merge sort.
+ *   Floats are ordered by their bit pattern, so -0.0 sorts before 0.0 and
+ *   NaNs go to the ends.
+ * - Arithmetic keys of the insertion element and the quicksort pivot are
+ *   cached in a register instead of being re-projected on every comparison.
+ *
+ * Key-index (indirect) sort for large records: the keys and 32-bit indices
+ * are extracted into two compact arrays and sorted together, so partition
+ * and merge never move the records. The resulting permutation is returned
+ * to the caller (argsortGeneric) or applied in place by following its
+ * cycles, moving every element once (applyPermutation).
+ */
+
+#ifndef GENERIC_SORT_H
+#define GENERIC_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Default comparator: a < b
+struct LessThan {
+    template <typename T>
+    bool operator()(const T& a, const T& b) const {
+        return a < b;
+    }
+};
+
+// Default projection: the element itself
+struct Identity {
+    template <typename T>
+    T&& operator()(T&& value) const {
+        return std::forward<T>(value);
+    }
+};
+
+const int GENERIC_INSERTION_THRESHOLD = 16;
+const int GENERIC_MERGE_BLOCK = 32;
+const int GENERIC_RADIX_THRESHOLD = 256;
+
+// Key type produced by Projection for elements of It
+template <typename It, typename Projection>
+struct ProjectedKey {
+    typedef typename std::decay<decltype(std::declval<Projection&>()(*std::declval<It&>()))>::type type;
+};
+
+// Arithmetic keys are copied into a local, other keys are held by reference
+template <typename Key>
+struct CachedKey {
+    typedef typename std::conditional<std::is_arithmetic<Key>::value, const Key, const Key&>::type type;
+};
+
+template <typename It, typename Compare = LessThan, typename Projection = Identity>
+void insertionSortGeneric(It first, It last, Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<It>::value_type Value;
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    if (last - first < 2) return;
+
+    for (It i = first + 1; i != last; ++i) {
+        if (!comp(proj(*i), proj(*(i - 1)))) continue;
+
+        Value value = std::move(*i);
+        typename CachedKey<Key>::type key = proj(value);
+        It j = i;
+        do {
+            *j = std::move(*(j - 1));
+            --j;
+        } while (j != first && comp(key, proj(*(j - 1))));
+        *j = std::move(value);
+    }
+}
+
+// Stable merge of [a, aEnd) and [b, bEnd) into out (elements are moved)
+template <typename InIt, typename OutIt, typename Compare, typename Projection>
+OutIt mergeMoveGeneric(InIt a, InIt aEnd, InIt b, InIt bEnd, OutIt out, Compare& comp, Projection& proj) {
+    while (a != aEnd && b != bEnd) {
+        if (comp(proj(*b), proj(*a))) {
+            *out = std::move(*b);
+            ++b;
+        } else {
+            *out = std::move(*a);
+            ++a;
+        }
+        ++out;
+    }
+    out = std::move(a, aEnd, out);
+    return std::move(b, bEnd, out);
+}
+
+// One bottom-up pass: merge neighbouring runs of width from src into dst
+template <typename InIt, typename OutIt, typename Compare, typename Projection>
+void mergePassGeneric(InIt src, OutIt dst, std::ptrdiff_t n, std::ptrdiff_t width,
+                      Compare& comp, Projection& proj) {
+    for (std::ptrdiff_t left = 0; left < n; left += 2 * width) {
+        std::ptrdiff_t mid = std::min(left + width, n);
+        std::ptrdiff_t right = std::min(left + 2 * width, n);
+        mergeMoveGeneric(src + left, src + mid, src + mid, src + right, dst + left, comp, proj);
+    }
+}
+
+// Stable bottom-up merge sort (ping-pong between the range and one buffer)
+template <typename It, typename Compare = LessThan, typename Projection = Identity>
+void mergeSortGeneric(It first, It last, Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename std::iterator_traits<It>::value_type Value;
+    std::ptrdiff_t n = last - first;
+    if (n < 2) return;
+
+    for (std::ptrdiff_t left = 0; left < n; left += GENERIC_MERGE_BLOCK) {
+        insertionSortGeneric(first + left, first + std::min(left + GENERIC_MERGE_BLOCK, n), comp, proj);
+    }
+    if (n <= GENERIC_MERGE_BLOCK) return;
+
+    std::vector<Value> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+    bool inBuffer = true;
+    for (std::ptrdiff_t width = GENERIC_MERGE_BLOCK; width < n; width *= 2) {
+        if (inBuffer) mergePassGeneric(buffer.begin(), first, n, width, comp, proj);
+        else mergePassGeneric(first, buffer.begin(), n, width, comp, proj);
+        inBuffer = !inBuffer;
+    }
+    if (inBuffer) std::move(buffer.begin(), buffer.end(), first);
+}
+
+// Order *a, *b, *c and move the median to *result
+template <typename It, typename Compare, typename Projection>
+void moveMedianToFirst(It result, It a, It b, It c, Compare& comp, Projection& proj) {
+    if (comp(proj(*a), proj(*b))) {
+        if (comp(proj(*b), proj(*c))) std::iter_swap(result, b);
+        else if (comp(proj(*a), proj(*c))) std::iter_swap(result, c);
+        else std::iter_swap(result, a);
+    } else if (comp(proj(*a), proj(*c))) {
+        std::iter_swap(result, a);
+    } else if (comp(proj(*b), proj(*c))) {
+        std::iter_swap(result, c);
+    } else {
+        std::iter_swap(result, b);
+    }
+}
+
+// Hoare partition of [first, last) around *pivot (outside the range);
+// the median-of-three guarantees both scans stop without bounds checks
+template <typename It, typename Compare, typename Projection>
+It partitionGeneric(It first, It last, It pivot, Compare& comp, Projection& proj) {
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    typename CachedKey<Key>::type pivotKey = proj(*pivot);
+    while (true) {
+        while (comp(proj(*first), pivotKey)) ++first;
+        --last;
+        while (comp(pivotKey, proj(*last))) --last;
+        if (!(first < last)) return first;
+        std::iter_swap(first, last);
+        ++first;
+    }
+}
+
+template <typename It, typename Compare, typename Projection>
+void quickSortGenericLoop(It first, It last, int depthLimit, Compare& comp, Projection& proj) {
+    typedef typename std::iterator_traits<It>::value_type Value;
+    while (last - first > GENERIC_INSERTION_THRESHOLD) {
+        if (depthLimit == 0) {
+            // Too many bad pivots: heapsort the rest
+            auto less = [&comp, &proj](const Value& a, const Value& b) { return comp(proj(a), proj(b)); };
+            std::make_heap(first, last, less);
+            std::sort_heap(first, last, less);
+            return;
+        }
+        depthLimit--;
+
+        It mid = first + (last - first) / 2;
+        moveMedianToFirst(first, first + 1, mid, last - 1, comp, proj);
+        It cut = partitionGeneric(first + 1, last, first, comp, proj);
+
+        // Recurse into the right part, loop on the left
+        quickSortGenericLoop(cut, last, depthLimit, comp, proj);
+        last = cut;
+    }
+}
+
+// Introsort: median-of-three quicksort, heapsort fallback, insertion sort finish
+template <typename It, typename Compare = LessThan, typename Projection = Identity>
+void quickSortGeneric(It first, It last, Compare comp = Compare(), Projection proj = Projection()) {
+    std::ptrdiff_t n = last - first;
+    if (n < 2) return;
+
+    int depthLimit = 0;
+    for (std::ptrdiff_t k = n; k > 1; k >>= 1) depthLimit += 2;
+    quickSortGenericLoop(first, last, depthLimit, comp, proj);
+    insertionSortGeneric(first, last, comp, proj);
+}
+
+// Unsigned integer with the same size as an arithmetic key
+template <int Bytes> struct RadixWord;
+template <> struct RadixWord<1> { typedef uint8_t type; };
+template <> struct RadixWord<2> { typedef uint16_t type; };
+template <> struct RadixWord<4> { typedef uint32_t type; };
+template <> struct RadixWord<8> { typedef uint64_t type; };
+
+// Keys that have an order-preserving unsigned encoding
+template <typename Key>
+struct HasRadixKey {
+    static const bool value =
+        (std::is_integral<Key>::value && !std::is_same<Key, bool>::value && sizeof(Key) <= 8) ||
+        (std::is_floating_point<Key>::value && (sizeof(Key) == 4 || sizeof(Key) == 8));
+};
+
+// Unsigned keys as they are
+template <typename Key>
+typename std::enable_if<std::is_unsigned<Key>::value, typename RadixWord<sizeof(Key)>::type>::type
+radixEncode(Key key) {
+    return key;
+}
+
+// Signed integers: flip the sign bit
+template <typename Key>
+typename std::enable_if<std::is_integral<Key>::value && std::is_signed<Key>::value,
+                        typename RadixWord<sizeof(Key)>::type>::type
+radixEncode(Key key) {
+    typedef typename RadixWord<sizeof(Key)>::type Word;
+    return (Word)((Word)key ^ ((Word)1 << (8 * sizeof(Key) - 1)));
+}
+
+// IEEE floats: flip all bits of negatives, only the sign bit of positives
+template <typename Key>
+typename std::enable_if<std::is_floating_point<Key>::value, typename RadixWord<sizeof(Key)>::type>::type
+radixEncode(Key key) {
+    typedef typename RadixWord<sizeof(Key)>::type Word;
+    Word bits;
+    std::memcpy(&bits, &key, sizeof(key));
+    const Word sign = (Word)1 << (8 * sizeof(Key) - 1);
+    return (bits & sign) ? (Word)~bits : (Word)(bits | sign);
+}
+
+// One LSD pass per key byte over items whose encoded key is word(item);
+// passes where every item has the same byte are skipped. Stable.
+template <typename Item, typename Word, typename WordOf>
+void radixPasses(std::vector<Item>& data, WordOf word) {
+    const int bytes = sizeof(Word);
+    std::size_t n = data.size();
+
+    std::vector<std::size_t> counts(bytes * 256, 0);
+    for (const Item& item : data) {
+        Word w = word(item);
+        for (int b = 0; b < bytes; b++) counts[b * 256 + ((w >> (8 * b)) & 0xFF)]++;
+    }
+
+    std::vector<Item> buffer(n);
+    for (int b = 0; b < bytes; b++) {
+        std::size_t* count = &counts[b * 256];
+        if (*std::max_element(count, count + 256) == n) continue;
+
+        std::size_t offsets[256];
+        std::size_t sum = 0;
+        for (int digit = 0; digit < 256; digit++) {
+            offsets[digit] = sum;
+            sum += count[digit];
+        }
+        for (std::size_t i = 0; i < n; i++) {
+            int digit = (int)((word(data[i]) >> (8 * b)) & 0xFF);
+            buffer[offsets[digit]++] = std::move(data[i]);
+        }
+        data.swap(buffer);
+    }
+}
+
+// Small elements are moved by every pass
+template <typename It, typename Projection>
+void radixSortByKey(It first, It last, Projection& proj, std::false_type) {
+    typedef typename std::iterator_traits<It>::value_type Value;
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    typedef typename RadixWord<sizeof(Key)>::type Word;
+
+    std::vector<Value> data(std::make_move_iterator(first), std::make_move_iterator(last));
+    radixPasses<Value, Word>(data, [&proj](const Value& value) { return radixEncode(proj(value)); });
+    std::move(data.begin(), data.end(), first);
+}
+
+// Prefetch every cache line of an element (used when applying a permutation)
+template <typename T>
+inline void prefetchElement(const T* element) {
+#if defined(__GNUC__) || defined(__clang__)
+    const char* bytes = (const char*)element;
+    for (std::size_t offset = 0; offset < sizeof(T); offset += 64) __builtin_prefetch(bytes + offset);
+#else
+    (void)element;
+#endif
+}
+
+// Reorder [first, last) so that position i receives old element order[i].
+// The permutation is applied in place by following its cycles: every
+// element is moved once, no record-sized buffer is needed, and the element
+// two steps ahead on the cycle is prefetched. Finished positions are
+// marked in order with the index 0xFFFFFFFF, so ranges hold at most
+// 2^32 - 1 elements; order is taken by value.
+template <typename It>
+void applyPermutation(It first, It last, std::vector<uint32_t> order) {
+    typedef typename std::iterator_traits<It>::value_type Value;
+    const uint32_t PLACED = 0xFFFFFFFFu;
+    uint32_t n = (uint32_t)(last - first);
+
+    for (uint32_t start = 0; start < n; start++) {
+        if (order[start] == start || order[start] == PLACED) continue;
+
+        Value held = std::move(*(first + start));
+        uint32_t position = start;
+        while (order[position] != start) {
+            uint32_t source = order[position];
+            uint32_t ahead = order[source];
+            if (ahead != start && ahead != PLACED) prefetchElement(&*(first + ahead));
+            *(first + position) = std::move(*(first + source));
+            order[position] = PLACED;
+            position = source;
+        }
+        *(first + position) = std::move(held);
+        order[position] = PLACED;
+    }
+}
+
+// Stable LSD radix argsort over a struct of arrays: the encoded keys and
+// their 32-bit indices are moved together, the elements are not touched
+template <typename It, typename Projection>
+void radixArgsort(It first, It last, Projection& proj, std::vector<uint32_t>& order) {
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    typedef typename RadixWord<sizeof(Key)>::type Word;
+    const int bytes = sizeof(Key);
+    std::size_t n = last - first;
+
+    std::vector<Word> keys(n);
+    order.resize(n);
+    std::vector<std::size_t> counts(bytes * 256, 0);
+    for (std::size_t i = 0; i < n; i++) {
+        keys[i] = radixEncode(proj(*(first + i)));
+        order[i] = (uint32_t)i;
+        for (int b = 0; b < bytes; b++) counts[b * 256 + ((keys[i] >> (8 * b)) & 0xFF)]++;
+    }
+
+    std::vector<Word> keyBuffer(n);
+    std::vector<uint32_t> orderBuffer(n);
+    for (int b = 0; b < bytes; b++) {
+        std::size_t* count = &counts[b * 256];
+        if (*std::max_element(count, count + 256) == n) continue;
+
+        std::size_t offsets[256];
+        std::size_t sum = 0;
+        for (int digit = 0; digit < 256; digit++) {
+            offsets[digit] = sum;
+            sum += count[digit];
+        }
+        for (std::size_t i = 0; i < n; i++) {
+            std::size_t target = offsets[(keys[i] >> (8 * b)) & 0xFF]++;
+            keyBuffer[target] = keys[i];
+            orderBuffer[target] = order[i];
+        }
+        keys.swap(keyBuffer);
+        order.swap(orderBuffer);
+    }
+}
+
+// Large elements: sort (key, index) pairs, then move each element once
+template <typename It, typename Projection>
+void radixSortByKey(It first, It last, Projection& proj, std::true_type) {
+    std::vector<uint32_t> order;
+    radixArgsort(first, last, proj, order);
+    applyPermutation(first, last, std::move(order));
+}
+
+// Other keys: extract them into a compact array and merge sort the indices
+template <typename It, typename Compare, typename Projection>
+void argsortDispatch(It first, It last, Compare& comp, Projection& proj,
+                     std::vector<uint32_t>& order, std::false_type) {
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    std::size_t n = last - first;
+
+    std::vector<Key> keys;
+    keys.reserve(n);
+    order.resize(n);
+    for (std::size_t i = 0; i < n; i++) {
+        keys.push_back(proj(*(first + i)));
+        order[i] = (uint32_t)i;
+    }
+    mergeSortGeneric(order.begin(), order.end(), comp,
+                     [&keys](uint32_t index) -> const Key& { return keys[index]; });
+}
+
+template <typename It, typename Compare, typename Projection>
+void argsortDispatch(It first, It last, Compare& comp, Projection& proj,
+                     std::vector<uint32_t>& order, std::true_type) {
+    if (last - first < GENERIC_RADIX_THRESHOLD) {
+        argsortDispatch(first, last, comp, proj, order, std::false_type());
+        return;
+    }
+    radixArgsort(first, last, proj, order);
+}
+
+// Stable argsort: order[i] is the index of the element that belongs at
+// position i. Radix sort for arithmetic keys with LessThan, merge sort of
+// the indices otherwise. Ranges are limited to 2^32 - 1 elements (the
+// largest 32-bit index is reserved by applyPermutation).
+template <typename It, typename Compare = LessThan, typename Projection = Identity>
+std::vector<uint32_t> argsortGeneric(It first, It last, Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    std::integral_constant<bool, HasRadixKey<Key>::value && std::is_same<Compare, LessThan>::value> fastPath;
+    std::vector<uint32_t> order;
+    argsortDispatch(first, last, comp, proj, order, fastPath);
+    return order;
+}
+
+// Stable key-index sort: argsort, then move every element exactly once
+template <typename It, typename Compare = LessThan, typename Projection = Identity>
+void indirectSortGeneric(It first, It last, Compare comp = Compare(), Projection proj = Projection()) {
+    applyPermutation(first, last, argsortGeneric(first, last, comp, proj));
+}
+
+template <typename It, typename Compare, typename Projection>
+void sortGenericDispatch(It first, It last, Compare& comp, Projection& proj, bool stable, std::false_type) {
+    if (stable) mergeSortGeneric(first, last, comp, proj);
+    else quickSortGeneric(first, last, comp, proj);
+}
+
+template <typename It, typename Compare, typename Projection>
+void sortGenericDispatch(It first, It last, Compare& comp, Projection& proj, bool stable, std::true_type) {
+    if (last - first < GENERIC_RADIX_THRESHOLD) {
+        sortGenericDispatch(first, last, comp, proj, stable, std::false_type());
+        return;
+    }
+    typedef typename std::iterator_traits<It>::value_type Value;
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    radixSortByKey(first, last, proj, std::integral_constant<bool, (sizeof(Value) > sizeof(Key) + 8)>());
+}
+
+// Fastest engine for the key type: radix sort for arithmetic keys with
+// LessThan, introsort otherwise
+template <typename It, typename Compare = LessThan, typename Projection = Identity>
+void sortGeneric(It first, It last, Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    std::integral_constant<bool, HasRadixKey<Key>::value && std::is_same<Compare, LessThan>::value> fastPath;
+    sortGenericDispatch(first, last, comp, proj, false, fastPath);
+}
+
+// Stable variant: radix sort for arithmetic keys with LessThan, merge sort otherwise
+template <typename It, typename Compare = LessThan, typename Projection = Identity>
+void stableSortGeneric(It first, It last, Compare comp = Compare(), Projection proj = Projection()) {
+    typedef typename ProjectedKey<It, Projection>::type Key;
+    std::integral_constant<bool, HasRadixKey<Key>::value && std::is_same<Compare, LessThan>::value> fastPath;
+    sortGenericDispatch(first, last, comp, proj, true, fastPath);
+}
+
+#endif
@@ -11,14 +11,30 @@
 #include <algorithm>
 #include <random>
 #include <iomanip>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include <thread>
+#include "thread_pool.h"
+#include "external_sort.h"
+#include "simd_sort.h"
+#include "benchmark.h"
+#include "perf_counters.h"
+#include "generic_sort.h"
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
 using namespace std;
 using namespace std::chrono;
 
+// Seed for all generated inputs (fixed, so runs are reproducible)
+unsigned int inputSeed = 42;
+
 // Function to generate random array
 vector<int> generateRandomArray(int size) {
     vector<int> arr(size);
-    random_device rd;
-    mt19937 gen(rd());
+    mt19937 gen(inputSeed + size);
     uniform_int_distribution<> dis(1, 10000);
     
     for (int i = 0; i < size; i++) {
@@ -27,6 +43,28 @@ vector<int> generateRandomArray(int size) {
     return arr;
 }
 
+// Array with only a few distinct values (duplicate-heavy)
+vector<int> generateFewUniqueArray(int size, int distinct) {
+    vector<int> arr(size);
+    mt19937 gen(size);
+    uniform_int_distribution<> dis(1, distinct);
+    for (int i = 0; i < size; i++) {
+        arr[i] = dis(gen);
+    }
+    return arr;
+}
+
+// Skewed array: exponentially distributed values, most keys are small
+vector<int> generateSkewedArray(int size) {
+    vector<int> arr(size);
+    mt19937 gen(size);
+    exponential_distribution<> dis(1.0);
+    for (int i = 0; i < size; i++) {
+        arr[i] = (int)(dis(gen) * 1000);
+    }
+    return arr;
+}
+
 // Bubble Sort
 void bubbleSort(vector<int>& arr) {
     int n = arr.size();
@@ -73,6 +111,92 @@ void mergeSort(vector<int>& arr, int left, int right) {
     }
 }
 
+// Bottom-Up Merge Sort (one scratch buffer per sort, ping-pong merging)
+const int INSERTION_BLOCK_SIZE = 32;
+
+void insertionSortRange(int* arr, int left, int right) {
+    for (int i = left + 1; i <= right; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= left && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+// Merge src[left..mid-1] and src[mid..right-1] into dst[left..right-1]
+void mergeRuns(const int* src, int* dst, int left, int mid, int right) {
+    int i = left, j = mid, k = left;
+    while (i < mid && j < right) {
+        if (src[i] <= src[j]) {
+            dst[k++] = src[i++];
+        } else {
+            dst[k++] = src[j++];
+        }
+    }
+    while (i < mid) dst[k++] = src[i++];
+    while (j < right) dst[k++] = src[j++];
+}
+
+// Sorts data[0..n-1] using scratch[0..n-1] as the ping-pong buffer
+void mergeSortBottomUp(int* data, int* scratch, int n) {
+    if (n < 2) return;
+    
+    for (int left = 0; left < n; left += INSERTION_BLOCK_SIZE) {
+        insertionSortRange(data, left, min(left + INSERTION_BLOCK_SIZE, n) - 1);
+    }
+    
+    int* src = data;
+    int* dst = scratch;
+    for (long long width = INSERTION_BLOCK_SIZE; width < n; width *= 2) {
+        for (long long left = 0; left < n; left += 2 * width) {
+            int mid = (int)min(left + width, (long long)n);
+            int right = (int)min(left + 2 * width, (long long)n);
+            mergeRuns(src, dst, (int)left, mid, right);
+        }
+        swap(src, dst);
+    }
+    if (src != data) copy(src, src + n, data);
+}
+
+// Bottom-up merge sort with sorting-network blocks and vectorized merges
+void mergeSortNetwork(int* data, int* scratch, int n) {
+    if (n < 2) return;
+    
+    for (int left = 0; left < n; left += SIMD_NETWORK_MAX) {
+        sortSmall(data + left, min(SIMD_NETWORK_MAX, n - left));
+    }
+    
+    int* src = data;
+    int* dst = scratch;
+    for (long long width = SIMD_NETWORK_MAX; width < n; width *= 2) {
+        for (long long left = 0; left < n; left += 2 * width) {
+            int mid = (int)min(left + width, (long long)n);
+            int right = (int)min(left + 2 * width, (long long)n);
+            mergeSortedRuns(src + left, mid - (int)left, src + mid, right - mid, dst + left);
+        }
+        swap(src, dst);
+    }
+    if (src != data) copy(src, src + n, data);
+}
+
+void mergeSortNetwork(vector<int>& arr) {
+    vector<int> buffer(arr.size());
+    mergeSortNetwork(arr.data(), buffer.data(), arr.size());
+}
+
+void mergeSortBottomUp(vector<int>& arr, vector<int>& buffer) {
+    if (buffer.size() < arr.size()) buffer.resize(arr.size());
+    mergeSortBottomUp(arr.data(), buffer.data(), arr.size());
+}
+
+void mergeSortBottomUp(vector<int>& arr) {
+    vector<int> buffer(arr.size());
+    mergeSortBottomUp(arr, buffer);
+}
+
 // Quick Sort
 int partition(vector<int>& arr, int low, int high) {
     int pivot = arr[high];
@@ -96,6 +220,743 @@ void quickSort(vector<int>& arr, int low, int high) {
     }
 }
 
+// Block Partition (BlockQuicksort): same contract as partition(), but the
+// offsets of misplaced elements are buffered without branching and swapped in batches
+const int PARTITION_BLOCK_SIZE = 64;
+
+int partitionBlock(vector<int>& arr, int low, int high) {
+    int pivot = arr[high];
+    int* a = arr.data();
+    int l = low, r = high - 1;  // a[low..l-1] <= pivot, a[r+1..high-1] > pivot
+    
+    unsigned char offsetsLeft[PARTITION_BLOCK_SIZE];
+    unsigned char offsetsRight[PARTITION_BLOCK_SIZE];
+    int startLeft = 0, numLeft = 0;
+    int startRight = 0, numRight = 0;
+    
+    while (r - l + 1 >= 2 * PARTITION_BLOCK_SIZE) {
+        if (numLeft == 0) {
+            startLeft = 0;
+            for (int i = 0; i < PARTITION_BLOCK_SIZE; i++) {
+                offsetsLeft[numLeft] = (unsigned char)i;
+                numLeft += (a[l + i] > pivot);
+            }
+        }
+        if (numRight == 0) {
+            startRight = 0;
+            for (int i = 0; i < PARTITION_BLOCK_SIZE; i++) {
+                offsetsRight[numRight] = (unsigned char)i;
+                numRight += (a[r - i] <= pivot);
+            }
+        }
+        
+        int num = min(numLeft, numRight);
+        for (int k = 0; k < num; k++) {
+            swap(a[l + offsetsLeft[startLeft + k]], a[r - offsetsRight[startRight + k]]);
+        }
+        numLeft -= num;
+        numRight -= num;
+        startLeft += num;
+        startRight += num;
+        
+        if (numLeft == 0) l += PARTITION_BLOCK_SIZE;
+        if (numRight == 0) r -= PARTITION_BLOCK_SIZE;
+    }
+    
+    // Branchless Lomuto pass over the remaining a[l..r]
+    int first = l;
+    for (int j = l; j <= r; j++) {
+        int value = a[j];
+        a[j] = a[first];
+        a[first] = value;
+        first += (value <= pivot);
+    }
+    swap(a[first], a[high]);
+    return first;
+}
+
+void quickSortBlock(vector<int>& arr, int low, int high) {
+    if (low < high) {
+        int pi = partitionBlock(arr, low, high);
+        quickSortBlock(arr, low, pi - 1);
+        quickSortBlock(arr, pi + 1, high);
+    }
+}
+
+// Introsort (median-of-three/ninther pivot, three-way partition,
+// smaller-side recursion, insertion sort cutoff, heap sort fallback)
+const int INSERTION_THRESHOLD = 16;
+const int NINTHER_THRESHOLD = 128;
+
+void siftDown(vector<int>& arr, int low, int root, int size) {
+    while (true) {
+        int largest = root;
+        int left = 2 * root + 1;
+        int right = left + 1;
+        if (left < size && arr[low + left] > arr[low + largest]) largest = left;
+        if (right < size && arr[low + right] > arr[low + largest]) largest = right;
+        if (largest == root) return;
+        swap(arr[low + root], arr[low + largest]);
+        root = largest;
+    }
+}
+
+void heapSortRange(vector<int>& arr, int low, int high) {
+    int size = high - low + 1;
+    for (int i = size / 2 - 1; i >= 0; i--) siftDown(arr, low, i, size);
+    for (int end = size - 1; end > 0; end--) {
+        swap(arr[low], arr[low + end]);
+        siftDown(arr, low, 0, end);
+    }
+}
+
+int medianOfThree(const vector<int>& arr, int a, int b, int c) {
+    if (arr[a] < arr[b]) {
+        if (arr[b] < arr[c]) return b;
+        return (arr[a] < arr[c]) ? c : a;
+    }
+    if (arr[a] < arr[c]) return a;
+    return (arr[b] < arr[c]) ? c : b;
+}
+
+int choosePivot(const vector<int>& arr, int low, int high) {
+    int n = high - low + 1;
+    int mid = low + n / 2;
+    if (n > NINTHER_THRESHOLD) {
+        int step = n / 8;
+        int m1 = medianOfThree(arr, low, low + step, low + 2 * step);
+        int m2 = medianOfThree(arr, mid - step, mid, mid + step);
+        int m3 = medianOfThree(arr, high - 2 * step, high - step, high);
+        return medianOfThree(arr, m1, m2, m3);
+    }
+    return medianOfThree(arr, low, mid, high);
+}
+
+// Bentley-McIlroy partition around arr[high]: afterwards arr[low..lessEnd] < pivot,
+// arr[greaterStart..high] > pivot and everything in between equals the pivot
+void partition3Way(vector<int>& arr, int low, int high, int& lessEnd, int& greaterStart) {
+    int pivot = arr[high];
+    int i = low - 1, j = high;
+    int p = low - 1, q = high;
+    while (true) {
+        while (arr[++i] < pivot);
+        while (pivot < arr[--j]) {
+            if (j == low) break;
+        }
+        if (i >= j) break;
+        swap(arr[i], arr[j]);
+        if (arr[i] == pivot) swap(arr[++p], arr[i]);
+        if (arr[j] == pivot) swap(arr[--q], arr[j]);
+    }
+    swap(arr[i], arr[high]);
+    j = i - 1;
+    i = i + 1;
+    for (int k = low; k <= p; k++, j--) swap(arr[k], arr[j]);
+    for (int k = high - 1; k >= q; k--, i++) swap(arr[k], arr[i]);
+    lessEnd = j;
+    greaterStart = i;
+}
+
+// useNetworks: finish ranges of up to SIMD_NETWORK_MAX with sortSmall
+// (sorting networks) instead of insertion sort
+void introSortLoop(vector<int>& arr, int low, int high, int depthLimit, bool useNetworks = false) {
+    int threshold = useNetworks ? SIMD_NETWORK_MAX : INSERTION_THRESHOLD;
+    while (high - low + 1 > threshold) {
+        if (depthLimit == 0) {
+            heapSortRange(arr, low, high);
+            return;
+        }
+        depthLimit--;
+        swap(arr[choosePivot(arr, low, high)], arr[high]);
+        
+        int lessEnd, greaterStart;
+        partition3Way(arr, low, high, lessEnd, greaterStart);
+        if (lessEnd - low < high - greaterStart) {
+            introSortLoop(arr, low, lessEnd, depthLimit, useNetworks);
+            low = greaterStart;
+        } else {
+            introSortLoop(arr, greaterStart, high, depthLimit, useNetworks);
+            high = lessEnd;
+        }
+    }
+    if (useNetworks) {
+        if (high > low) sortSmall(arr.data() + low, high - low + 1);
+    } else {
+        insertionSortRange(arr.data(), low, high);
+    }
+}
+
+void introSort(vector<int>& arr, int low, int high) {
+    if (low >= high) return;
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;
+    introSortLoop(arr, low, high, depthLimit);
+}
+
+// Introsort with the sorting-network base case
+void introSortNetwork(vector<int>& arr, int low, int high) {
+    if (low >= high) return;
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;
+    introSortLoop(arr, low, high, depthLimit, true);
+}
+
+// Selection: nth element, partial sort and streaming top-k
+// k is a 0-based rank. After introSelect(arr, low, high, k), arr[k] holds the
+// value a full sort would put there, arr[low..k-1] <= arr[k] <= arr[k+1..high].
+
+// Worst-case linear selection (median of medians of groups of 5)
+void medianOfMediansSelect(vector<int>& arr, int low, int high, int k) {
+    while (high - low + 1 > INSERTION_THRESHOLD) {
+        // Move the median of every group of 5 to the front of the range
+        int medians = 0;
+        for (int group = low; group <= high; group += 5) {
+            int groupEnd = min(group + 4, high);
+            insertionSortRange(arr.data(), group, groupEnd);
+            swap(arr[low + medians], arr[(group + groupEnd) / 2]);
+            medians++;
+        }
+        
+        // Their median has at least ~30% of the range on either side
+        int mid = low + (medians - 1) / 2;
+        medianOfMediansSelect(arr, low, low + medians - 1, mid);
+        swap(arr[mid], arr[high]);
+        
+        int lessEnd, greaterStart;
+        partition3Way(arr, low, high, lessEnd, greaterStart);
+        if (k <= lessEnd) high = lessEnd;
+        else if (k >= greaterStart) low = greaterStart;
+        else return;
+    }
+    insertionSortRange(arr.data(), low, high);
+}
+
+// Introselect: quickselect with the introsort pivot and three-way partition;
+// after 2*log2(n) partitions without finishing, median of medians takes over
+void introSelect(vector<int>& arr, int low, int high, int k) {
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;
+    
+    while (high - low + 1 > INSERTION_THRESHOLD) {
+        if (depthLimit == 0) {
+            medianOfMediansSelect(arr, low, high, k);
+            return;
+        }
+        depthLimit--;
+        swap(arr[choosePivot(arr, low, high)], arr[high]);
+        
+        // Keys equal to the pivot are final, so only one side remains
+        int lessEnd, greaterStart;
+        partition3Way(arr, low, high, lessEnd, greaterStart);
+        if (k <= lessEnd) high = lessEnd;
+        else if (k >= greaterStart) low = greaterStart;
+        else return;
+    }
+    insertionSortRange(arr.data(), low, high);
+}
+
+void nthElement(vector<int>& arr, int k) {
+    if (k >= 0 && k < (int)arr.size()) introSelect(arr, 0, (int)arr.size() - 1, k);
+}
+
+// Below k = n / PARTIAL_HEAP_RATIO a heap over the prefix beats introselect:
+// one pass, and for most inputs almost no value enters the heap
+const int PARTIAL_HEAP_RATIO = 1024;
+
+// In-place heap select: arr[0..k-1] is a max-heap of the k smallest seen so far
+void heapSelectPrefix(vector<int>& arr, int k) {
+    int n = arr.size();
+    for (int i = k / 2 - 1; i >= 0; i--) siftDown(arr, 0, i, k);
+    for (int i = k; i < n; i++) {
+        if (arr[i] < arr[0]) {
+            swap(arr[0], arr[i]);
+            siftDown(arr, 0, 0, k);
+        }
+    }
+}
+
+// The k smallest values in sorted order in arr[0..k-1] (the rest in any order)
+void partialSort(vector<int>& arr, int k) {
+    int n = arr.size();
+    k = min(k, n);
+    if (k <= 0) return;
+    if (k <= n / PARTIAL_HEAP_RATIO) {
+        heapSelectPrefix(arr, k);
+        heapSortRange(arr, 0, k - 1);
+        return;
+    }
+    if (k < n) introSelect(arr, 0, n - 1, k - 1);
+    introSort(arr, 0, k - 1);
+}
+
+// k smallest values of a stream in O(k) memory: a max-heap whose root is
+// the largest value kept, so a new value only enters if it is smaller
+class StreamingTopK {
+public:
+    explicit StreamingTopK(int k) : k(max(k, 0)) {
+        heap.reserve(this->k);
+    }
+    
+    void push(int value) {
+        if ((int)heap.size() < k) {
+            heap.push_back(value);
+            for (int i = heap.size() - 1; i > 0 && heap[(i - 1) / 2] < heap[i]; i = (i - 1) / 2) {
+                swap(heap[i], heap[(i - 1) / 2]);
+            }
+        } else if (k > 0 && value < heap[0]) {
+            heap[0] = value;
+            siftDown(heap, 0, 0, k);
+        }
+    }
+    
+    // The values kept so far, in ascending order
+    vector<int> sorted() const {
+        vector<int> result = heap;
+        heapSortRange(result, 0, (int)result.size() - 1);
+        return result;
+    }
+    
+private:
+    int k;
+    vector<int> heap;
+};
+
+// Streaming top-k of a binary file of 32-bit ints (the --external format)
+bool streamingTopKFile(const string& path, int k, vector<int>& result, long long& count) {
+    long long bytesRead = 0;
+    PrefetchingReader reader(path, 1 << 16, bytesRead);
+    if (!reader.isOpen()) return false;
+    
+    StreamingTopK topK(k);
+    vector<int> block(1 << 16);
+    size_t n;
+    while ((n = reader.readBlock(block)) > 0) {
+        for (size_t i = 0; i < n; i++) topK.push(block[i]);
+    }
+    count = bytesRead / sizeof(int);
+    result = topK.sorted();
+    return true;
+}
+
+// LSD Radix Sort (11-bit digits, one histogram pass, skips constant digits,
+// sign bit flipped for signed keys, ping-pong buffer)
+const int RADIX_BITS = 11;
+const int RADIX_BUCKETS = 1 << RADIX_BITS;
+const int RADIX_PASSES = (32 + RADIX_BITS - 1) / RADIX_BITS;
+const unsigned int RADIX_MASK = RADIX_BUCKETS - 1;
+
+unsigned int radixKey(int value) {
+    return (unsigned int)value ^ 0x80000000u;
+}
+
+void radixSort(vector<int>& arr, vector<int>& buffer) {
+    int n = arr.size();
+    if (n < 2) return;
+    if ((int)buffer.size() < n) buffer.resize(n);
+    
+    vector<int> counts(RADIX_PASSES * RADIX_BUCKETS, 0);
+    for (int i = 0; i < n; i++) {
+        unsigned int key = radixKey(arr[i]);
+        for (int pass = 0; pass < RADIX_PASSES; pass++) {
+            counts[pass * RADIX_BUCKETS + ((key >> (pass * RADIX_BITS)) & RADIX_MASK)]++;
+        }
+    }
+    
+    int* src = arr.data();
+    int* dst = buffer.data();
+    for (int pass = 0; pass < RADIX_PASSES; pass++) {
+        int* count = &counts[pass * RADIX_BUCKETS];
+        int shift = pass * RADIX_BITS;
+        if (count[(radixKey(src[0]) >> shift) & RADIX_MASK] == n) continue;
+        
+        int sum = 0;
+        for (int b = 0; b < RADIX_BUCKETS; b++) {
+            int c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+        for (int i = 0; i < n; i++) {
+            unsigned int digit = (radixKey(src[i]) >> shift) & RADIX_MASK;
+            dst[count[digit]++] = src[i];
+        }
+        swap(src, dst);
+    }
+    if (src != arr.data()) copy(src, src + n, arr.data());
+}
+
+void radixSort(vector<int>& arr) {
+    vector<int> buffer(arr.size());
+    radixSort(arr, buffer);
+}
+
+// Timsort-style adaptive merge sort (stable)
+// - Finds natural runs; strictly descending runs are reversed in place
+// - Short runs are extended to minRun with binary insertion sort
+// - Runs are merged under the Timsort stack invariants; merges switch to
+//   galloping (exponential search) when one run keeps winning
+// Sorted or nearly sorted input costs close to O(n)
+const int TIMSORT_MIN_MERGE = 32;
+const int TIMSORT_MIN_GALLOP = 7;
+
+class TimSort {
+public:
+    TimSort(int* a, int n) : a(a), minGallop(TIMSORT_MIN_GALLOP) {
+        tmp.reserve(min(n / 2 + 1, 256));
+    }
+    
+    void sort(int n) {
+        if (n < 2) return;
+        
+        if (n < TIMSORT_MIN_MERGE) {
+            int runLen = countRunAndMakeAscending(0, n);
+            binaryInsertionSort(0, n, runLen);
+            return;
+        }
+        
+        int minRun = minRunLength(n);
+        int lo = 0, remaining = n;
+        while (remaining > 0) {
+            int runLen = countRunAndMakeAscending(lo, lo + remaining);
+            
+            // Extend short runs to min(minRun, remaining)
+            if (runLen < minRun) {
+                int force = min(remaining, minRun);
+                binaryInsertionSort(lo, lo + force, lo + runLen);
+                runLen = force;
+            }
+            
+            runStackBase.push_back(lo);
+            runStackLength.push_back(runLen);
+            mergeCollapse();
+            
+            lo += runLen;
+            remaining -= runLen;
+        }
+        mergeForceCollapse();
+    }
+    
+private:
+    // n / 2^k rounded up, in [16, 32] (so the number of runs is close to a power of 2)
+    static int minRunLength(int n) {
+        int r = 0;
+        while (n >= TIMSORT_MIN_MERGE) {
+            r |= n & 1;
+            n >>= 1;
+        }
+        return n + r;
+    }
+    
+    // Length of the run starting at lo; a strictly descending run is reversed
+    int countRunAndMakeAscending(int lo, int hi) {
+        int runHi = lo + 1;
+        if (runHi == hi) return 1;
+        
+        if (a[runHi++] < a[lo]) {
+            while (runHi < hi && a[runHi] < a[runHi - 1]) runHi++;
+            reverse(a + lo, a + runHi);
+        } else {
+            while (runHi < hi && a[runHi] >= a[runHi - 1]) runHi++;
+        }
+        return runHi - lo;
+    }
+    
+    // Sort a[lo..hi-1], where a[lo..start-1] is already sorted
+    void binaryInsertionSort(int lo, int hi, int start) {
+        for (; start < hi; start++) {
+            int pivot = a[start];
+            int left = lo, right = start;
+            while (left < right) {
+                int mid = left + (right - left) / 2;
+                if (pivot < a[mid]) right = mid;
+                else left = mid + 1;
+            }
+            copy_backward(a + left, a + start, a + start + 1);
+            a[left] = pivot;
+        }
+    }
+    
+    static int nextGallopOffset(int ofs, int maxOfs) {
+        return (ofs > (maxOfs - 1) / 2) ? maxOfs : 2 * ofs + 1;
+    }
+    
+    // Leftmost position to insert key in the sorted run[0..len-1], searching from hint
+    static int gallopLeft(int key, const int* run, int len, int hint) {
+        int lastOfs = 0, ofs = 1;
+        if (key > run[hint]) {
+            int maxOfs = len - hint;
+            while (ofs < maxOfs && key > run[hint + ofs]) {
+                lastOfs = ofs;
+                ofs = nextGallopOffset(ofs, maxOfs);
+            }
+            ofs = min(ofs, maxOfs);
+            lastOfs += hint;
+            ofs += hint;
+        } else {
+            int maxOfs = hint + 1;
+            while (ofs < maxOfs && key <= run[hint - ofs]) {
+                lastOfs = ofs;
+                ofs = nextGallopOffset(ofs, maxOfs);
+            }
+            ofs = min(ofs, maxOfs);
+            int oldLast = lastOfs;
+            lastOfs = hint - ofs;
+            ofs = hint - oldLast;
+        }
+        
+        // Binary search in run[lastOfs+1..ofs]
+        lastOfs++;
+        while (lastOfs < ofs) {
+            int m = lastOfs + (ofs - lastOfs) / 2;
+            if (key > run[m]) lastOfs = m + 1;
+            else ofs = m;
+        }
+        return ofs;
+    }
+    
+    // Rightmost position to insert key in the sorted run[0..len-1], searching from hint
+    static int gallopRight(int key, const int* run, int len, int hint) {
+        int lastOfs = 0, ofs = 1;
+        if (key < run[hint]) {
+            int maxOfs = hint + 1;
+            while (ofs < maxOfs && key < run[hint - ofs]) {
+                lastOfs = ofs;
+                ofs = nextGallopOffset(ofs, maxOfs);
+            }
+            ofs = min(ofs, maxOfs);
+            int oldLast = lastOfs;
+            lastOfs = hint - ofs;
+            ofs = hint - oldLast;
+        } else {
+            int maxOfs = len - hint;
+            while (ofs < maxOfs && key >= run[hint + ofs]) {
+                lastOfs = ofs;
+                ofs = nextGallopOffset(ofs, maxOfs);
+            }
+            ofs = min(ofs, maxOfs);
+            lastOfs += hint;
+            ofs += hint;
+        }
+        
+        lastOfs++;
+        while (lastOfs < ofs) {
+            int m = lastOfs + (ofs - lastOfs) / 2;
+            if (key < run[m]) ofs = m;
+            else lastOfs = m + 1;
+        }
+        return ofs;
+    }
+    
+    // Restore the invariants runLen[i-2] > runLen[i-1] + runLen[i] and runLen[i-1] > runLen[i]
+    void mergeCollapse() {
+        while (runStackLength.size() > 1) {
+            int n = (int)runStackLength.size() - 2;
+            if ((n > 0 && runStackLength[n - 1] <= runStackLength[n] + runStackLength[n + 1]) ||
+                (n > 1 && runStackLength[n - 2] <= runStackLength[n] + runStackLength[n - 1])) {
+                if (runStackLength[n - 1] < runStackLength[n + 1]) n--;
+            } else if (runStackLength[n] > runStackLength[n + 1]) {
+                break;
+            }
+            mergeAt(n);
+        }
+    }
+    
+    void mergeForceCollapse() {
+        while (runStackLength.size() > 1) {
+            int n = (int)runStackLength.size() - 2;
+            if (n > 0 && runStackLength[n - 1] < runStackLength[n + 1]) n--;
+            mergeAt(n);
+        }
+    }
+    
+    // Merge stack runs i and i + 1
+    void mergeAt(int i) {
+        int base1 = runStackBase[i], len1 = runStackLength[i];
+        int base2 = runStackBase[i + 1], len2 = runStackLength[i + 1];
+        
+        runStackLength[i] = len1 + len2;
+        runStackBase.erase(runStackBase.begin() + i + 1);
+        runStackLength.erase(runStackLength.begin() + i + 1);
+        
+        // Elements of run 1 already <= run 2's first element stay in place
+        int k = gallopRight(a[base2], a + base1, len1, 0);
+        base1 += k;
+        len1 -= k;
+        if (len1 == 0) return;
+        
+        // Elements of run 2 already >= run 1's last element stay in place
+        len2 = gallopLeft(a[base1 + len1 - 1], a + base2, len2, len2 - 1);
+        if (len2 == 0) return;
+        
+        if (len1 <= len2) mergeLo(base1, len1, base2, len2);
+        else mergeHi(base1, len1, base2, len2);
+    }
+    
+    // Merge left to right, with the shorter first run copied to tmp
+    void mergeLo(int base1, int len1, int base2, int len2) {
+        tmp.assign(a + base1, a + base1 + len1);
+        int* t = tmp.data();
+        int cursor1 = 0, cursor2 = base2, dest = base1;
+        
+        a[dest++] = a[cursor2++];
+        if (--len2 == 0) {
+            copy(t + cursor1, t + cursor1 + len1, a + dest);
+            return;
+        }
+        if (len1 == 1) {
+            copy(a + cursor2, a + cursor2 + len2, a + dest);
+            a[dest + len2] = t[cursor1];
+            return;
+        }
+        
+        int gallop = minGallop;
+        while (true) {
+            int count1 = 0, count2 = 0;
+            
+            // One element at a time until one run wins gallop times in a row
+            do {
+                if (a[cursor2] < t[cursor1]) {
+                    a[dest++] = a[cursor2++];
+                    count2++;
+                    count1 = 0;
+                    if (--len2 == 0) goto done;
+                } else {
+                    a[dest++] = t[cursor1++];
+                    count1++;
+                    count2 = 0;
+                    if (--len1 == 1) goto done;
+                }
+            } while ((count1 | count2) < gallop);
+            
+            // Galloping mode: copy whole stretches found by exponential search
+            do {
+                count1 = gallopRight(a[cursor2], t + cursor1, len1, 0);
+                if (count1 != 0) {
+                    copy(t + cursor1, t + cursor1 + count1, a + dest);
+                    dest += count1;
+                    cursor1 += count1;
+                    len1 -= count1;
+                    if (len1 <= 1) goto done;
+                }
+                a[dest++] = a[cursor2++];
+                if (--len2 == 0) goto done;
+                
+                count2 = gallopLeft(t[cursor1], a + cursor2, len2, 0);
+                if (count2 != 0) {
+                    copy(a + cursor2, a + cursor2 + count2, a + dest);
+                    dest += count2;
+                    cursor2 += count2;
+                    len2 -= count2;
+                    if (len2 == 0) goto done;
+                }
+                a[dest++] = t[cursor1++];
+                if (--len1 == 1) goto done;
+                gallop--;
+            } while (count1 >= TIMSORT_MIN_GALLOP || count2 >= TIMSORT_MIN_GALLOP);
+            
+            // Penalize leaving galloping mode
+            if (gallop < 0) gallop = 0;
+            gallop += 2;
+        }
+        
+    done:
+        minGallop = max(gallop, 1);
+        if (len1 == 1) {
+            copy(a + cursor2, a + cursor2 + len2, a + dest);
+            a[dest + len2] = t[cursor1];
+        } else {
+            copy(t + cursor1, t + cursor1 + len1, a + dest);
+        }
+    }
+    
+    // Merge right to left, with the shorter second run copied to tmp
+    void mergeHi(int base1, int len1, int base2, int len2) {
+        tmp.assign(a + base2, a + base2 + len2);
+        int* t = tmp.data();
+        int cursor1 = base1 + len1 - 1, cursor2 = len2 - 1, dest = base2 + len2 - 1;
+        
+        a[dest--] = a[cursor1--];
+        if (--len1 == 0) {
+            copy(t, t + len2, a + dest - (len2 - 1));
+            return;
+        }
+        if (len2 == 1) {
+            dest -= len1;
+            cursor1 -= len1;
+            copy_backward(a + cursor1 + 1, a + cursor1 + 1 + len1, a + dest + 1 + len1);
+            a[dest] = t[cursor2];
+            return;
+        }
+        
+        int gallop = minGallop;
+        while (true) {
+            int count1 = 0, count2 = 0;
+            
+            do {
+                if (t[cursor2] < a[cursor1]) {
+                    a[dest--] = a[cursor1--];
+                    count1++;
+                    count2 = 0;
+                    if (--len1 == 0) goto done;
+                } else {
+                    a[dest--] = t[cursor2--];
+                    count2++;
+                    count1 = 0;
+                    if (--len2 == 1) goto done;
+                }
+            } while ((count1 | count2) < gallop);
+            
+            do {
+                count1 = len1 - gallopRight(t[cursor2], a + base1, len1, len1 - 1);
+                if (count1 != 0) {
+                    dest -= count1;
+                    cursor1 -= count1;
+                    len1 -= count1;
+                    copy_backward(a + cursor1 + 1, a + cursor1 + 1 + count1, a + dest + 1 + count1);
+                    if (len1 == 0) goto done;
+                }
+                a[dest--] = t[cursor2--];
+                if (--len2 == 1) goto done;
+                
+                count2 = len2 - gallopLeft(a[cursor1], t, len2, len2 - 1);
+                if (count2 != 0) {
+                    dest -= count2;
+                    cursor2 -= count2;
+                    len2 -= count2;
+                    copy(t + cursor2 + 1, t + cursor2 + 1 + count2, a + dest + 1);
+                    if (len2 <= 1) goto done;
+                }
+                a[dest--] = a[cursor1--];
+                if (--len1 == 0) goto done;
+                gallop--;
+            } while (count1 >= TIMSORT_MIN_GALLOP || count2 >= TIMSORT_MIN_GALLOP);
+            
+            if (gallop < 0) gallop = 0;
+            gallop += 2;
+        }
+        
+    done:
+        minGallop = max(gallop, 1);
+        if (len2 == 1) {
+            dest -= len1;
+            cursor1 -= len1;
+            copy_backward(a + cursor1 + 1, a + cursor1 + 1 + len1, a + dest + 1 + len1);
+            a[dest] = t[cursor2];
+        } else {
+            copy(t, t + len2, a + dest - (len2 - 1));
+        }
+    }
+    
+    int* a;
+    int minGallop;
+    vector<int> tmp;
+    vector<int> runStackBase, runStackLength;  // Pending runs (Timsort stack)
+};
+
+void timSort(vector<int>& arr) {
+    TimSort sorter(arr.data(), arr.size());
+    sorter.sort(arr.size());
+}
+
 // Insertion Sort
 void insertionSort(vector<int>& arr) {
     int n = arr.size();
@@ -124,43 +985,1476 @@ void selectionSort(vector<int>& arr) {
     }
 }
 
-// Function to measure execution time
-double measureTime(void (*sortFunc)(vector<int>&), vector<int> arr) {
-    auto start = high_resolution_clock::now();
-    sortFunc(arr);
-    auto stop = high_resolution_clock::now();
-    auto duration = duration_cast<microseconds>(stop - start);
-    return duration.count() / 1000.0;  // Convert to milliseconds
+// Parallel Merge Sort on a work-stealing pool
+// Halves are sorted as separate tasks; merges are split recursively so the
+// top-level merge runs in parallel too
+const int PARALLEL_SORT_GRAIN = 1 << 14;   // Sequential sort below this size
+const int PARALLEL_MERGE_GRAIN = 1 << 15;  // Sequential merge below this size
+
+// Merge a[0..na-1] and b[0..nb-1] into dst
+void parallelMerge(WorkStealingPool& pool, const int* a, int na, const int* b, int nb, int* dst) {
+    if (na + nb <= PARALLEL_MERGE_GRAIN) {
+        merge(a, a + na, b, b + nb, dst);
+        return;
+    }
+    if (na < nb) {
+        swap(a, b);
+        swap(na, nb);
+    }
+    
+    // Split around the middle of the larger run
+    int ma = na / 2;
+    int mb = lower_bound(b, b + nb, a[ma]) - b;
+    dst[ma + mb] = a[ma];
+    
+    TaskGroup group(pool);
+    group.run([=, &pool]() { parallelMerge(pool, a, ma, b, mb, dst); });
+    parallelMerge(pool, a + ma + 1, na - ma - 1, b + mb, nb - mb, dst + ma + mb + 1);
+    group.wait();
 }
 
-double measureTimeMerge(void (*sortFunc)(vector<int>&, int, int), vector<int> arr) {
-    auto start = high_resolution_clock::now();
-    sortFunc(arr, 0, arr.size() - 1);
-    auto stop = high_resolution_clock::now();
-    auto duration = duration_cast<microseconds>(stop - start);
-    return duration.count() / 1000.0;
+// Sort data[0..n-1]; the result ends up in scratch if resultInScratch is set
+void parallelMergeSortRange(WorkStealingPool& pool, int* data, int* scratch, int n, bool resultInScratch) {
+    if (n <= PARALLEL_SORT_GRAIN) {
+        mergeSortBottomUp(data, scratch, n);
+        if (resultInScratch) copy(data, data + n, scratch);
+        return;
+    }
+    
+    // Children leave their halves in the other buffer, so no copy-back is needed
+    int half = n / 2;
+    TaskGroup group(pool);
+    group.run([=, &pool]() { parallelMergeSortRange(pool, data, scratch, half, !resultInScratch); });
+    parallelMergeSortRange(pool, data + half, scratch + half, n - half, !resultInScratch);
+    group.wait();
+    
+    const int* src = resultInScratch ? data : scratch;
+    int* dst = resultInScratch ? scratch : data;
+    parallelMerge(pool, src, half, src + half, n - half, dst);
 }
 
-double measureTimeQuick(void (*sortFunc)(vector<int>&, int, int), vector<int> arr) {
-    auto start = high_resolution_clock::now();
-    sortFunc(arr, 0, arr.size() - 1);
-    auto stop = high_resolution_clock::now();
-    auto duration = duration_cast<microseconds>(stop - start);
-    return duration.count() / 1000.0;
+void parallelMergeSort(vector<int>& arr, WorkStealingPool& pool) {
+    vector<int> buffer(arr.size());
+    parallelMergeSortRange(pool, arr.data(), buffer.data(), arr.size(), false);
 }
 
-int main() {
+int hardwareThreads() {
+    int threads = thread::hardware_concurrency();
+    return threads > 0 ? threads : 1;
+}
+
+// Shared pool with one thread per hardware thread
+WorkStealingPool& defaultPool() {
+    static WorkStealingPool pool(hardwareThreads());
+    return pool;
+}
+
+void parallelMergeSort(vector<int>& arr) {
+    parallelMergeSort(arr, defaultPool());
+}
+
+// Parallel Sample Sort
+// 1. Oversample and pick splitters
+// 2. Classify every element once (bucket ids stored in an oracle array)
+// 3. One prefix sum over (bucket, chunk) counts gives every chunk its
+//    output offsets, then all chunks scatter in parallel
+// 4. Buckets are sorted in parallel with introSort
+// Keys equal to a splitter get their own bucket, which needs no sorting,
+// so duplicate-heavy input cannot overload a single bucket
+const int SAMPLE_SORT_MIN_SIZE = 1 << 16;   // introSort below this size
+const int SAMPLE_OVERSAMPLING = 32;         // Samples per bucket
+const int SAMPLE_BUCKETS_PER_THREAD = 16;
+const int SAMPLE_MAX_BUCKETS = 1024;        // Bucket ids fit in 16 bits
+
+// Bucket of a value: 2i for splitters[i-1] < value < splitters[i],
+// 2i + 1 for value == splitters[i]
+inline int sampleSortBucket(const int* splitters, int numSplitters, int value) {
+    // Branchless lower_bound over the splitters
+    const int* base = splitters;
+    int len = numSplitters;
+    while (len > 1) {
+        int half = len / 2;
+        base += (base[half - 1] < value) ? half : 0;
+        len -= half;
+    }
+    int i = (int)(base - splitters) + ((len == 1 && *base < value) ? 1 : 0);
+    return 2 * i + ((i < numSplitters && splitters[i] == value) ? 1 : 0);
+}
+
+// Sorts data[begin..end-1] using buffer[begin..end-1] as scratch space
+void sampleSortRange(WorkStealingPool& pool, vector<int>& data, vector<int>& buffer, int begin, int end) {
+    int n = end - begin;
+    if (n <= SAMPLE_SORT_MIN_SIZE) {
+        introSort(data, begin, end - 1);
+        return;
+    }
+    
+    int threads = pool.threadCount();
+    int targetBuckets = min(SAMPLE_MAX_BUCKETS, max(2, threads * SAMPLE_BUCKETS_PER_THREAD));
+    
+    // Oversample (fixed seed, so runs are reproducible) and pick evenly spaced splitters
+    mt19937 gen(n);
+    uniform_int_distribution<int> pick(begin, end - 1);
+    vector<int> sample(targetBuckets * SAMPLE_OVERSAMPLING);
+    for (int& value : sample) value = data[pick(gen)];
+    sort(sample.begin(), sample.end());
+    
+    vector<int> splitters;
+    for (int b = 1; b < targetBuckets; b++) {
+        splitters.push_back(sample[b * SAMPLE_OVERSAMPLING]);
+    }
+    splitters.erase(unique(splitters.begin(), splitters.end()), splitters.end());
+    int numSplitters = splitters.size();
+    int numBuckets = 2 * numSplitters + 1;
+    
+    // Classify in parallel: one chunk per thread
+    int numChunks = threads;
+    int chunkSize = (n + numChunks - 1) / numChunks;
+    vector<unsigned short> oracle(n);
+    vector<int> counts((size_t)numChunks * numBuckets, 0);
+    {
+        TaskGroup group(pool);
+        for (int c = 0; c < numChunks; c++) {
+            group.run([&, c]() {
+                int from = c * chunkSize;
+                int to = min(n, from + chunkSize);
+                int* count = &counts[(size_t)c * numBuckets];
+                for (int j = from; j < to; j++) {
+                    int bucket = sampleSortBucket(splitters.data(), numSplitters, data[begin + j]);
+                    oracle[j] = (unsigned short)bucket;
+                    count[bucket]++;
+                }
+            });
+        }
+        group.wait();
+    }
+    
+    // Single prefix sum, bucket-major, turns counts into scatter offsets
+    vector<int> bucketStart(numBuckets + 1);
+    int sum = begin;
+    for (int b = 0; b < numBuckets; b++) {
+        bucketStart[b] = sum;
+        for (int c = 0; c < numChunks; c++) {
+            int count = counts[(size_t)c * numBuckets + b];
+            counts[(size_t)c * numBuckets + b] = sum;
+            sum += count;
+        }
+    }
+    bucketStart[numBuckets] = sum;
+    
+    // Scatter into the buffer
+    {
+        TaskGroup group(pool);
+        for (int c = 0; c < numChunks; c++) {
+            group.run([&, c]() {
+                int from = c * chunkSize;
+                int to = min(n, from + chunkSize);
+                int* offset = &counts[(size_t)c * numBuckets];
+                for (int j = from; j < to; j++) {
+                    buffer[offset[oracle[j]]++] = data[begin + j];
+                }
+            });
+        }
+        group.wait();
+    }
+    
+    // Sort buckets in the buffer and copy them back while they are still in cache
+    // Oversized buckets (possible with unlucky samples) are sample sorted again
+    TaskGroup group(pool);
+    for (int b = 0; b < numBuckets; b++) {
+        int from = bucketStart[b];
+        int to = bucketStart[b + 1];
+        if (from == to) continue;
+        
+        group.run([&, b, from, to]() {
+            bool equalKeys = (b % 2 == 1);
+            if (!equalKeys) {
+                if (to - from > SAMPLE_SORT_MIN_SIZE && to - from < n / 2) {
+                    sampleSortRange(pool, buffer, data, from, to);
+                } else {
+                    introSort(buffer, from, to - 1);
+                }
+            }
+            copy(buffer.begin() + from, buffer.begin() + to, data.begin() + from);
+        });
+    }
+    group.wait();
+}
+
+void parallelSampleSort(vector<int>& arr, WorkStealingPool& pool) {
+    vector<int> buffer(arr.size());
+    sampleSortRange(pool, arr, buffer, 0, arr.size());
+}
+
+void parallelSampleSort(vector<int>& arr) {
+    parallelSampleSort(arr, defaultPool());
+}
+
+// Parallel partial sort for large k: selection is linear, so sorting the
+// k-element prefix (k log k) dominates; that sort runs on the pool
+void parallelPartialSort(vector<int>& arr, int k, WorkStealingPool& pool) {
+    int n = arr.size();
+    k = min(k, n);
+    if (k <= PARALLEL_SORT_GRAIN) {
+        partialSort(arr, k);
+        return;
+    }
+    if (k < n) introSelect(arr, 0, n - 1, k - 1);
+    
+    vector<int> scratch(k);
+    parallelMergeSortRange(pool, arr.data(), scratch.data(), k, false);
+}
+
+void parallelPartialSort(vector<int>& arr, int k) {
+    parallelPartialSort(arr, k, defaultPool());
+}
+
+// Whole-array wrappers for the (arr, low, high) sorts
+void mergeSortAll(vector<int>& arr) {
+    mergeSort(arr, 0, (int)arr.size() - 1);
+}
+
+void quickSortAll(vector<int>& arr) {
+    quickSort(arr, 0, (int)arr.size() - 1);
+}
+
+void quickSortBlockAll(vector<int>& arr) {
+    quickSortBlock(arr, 0, (int)arr.size() - 1);
+}
+
+void introSortAll(vector<int>& arr) {
+    introSort(arr, 0, (int)arr.size() - 1);
+}
+
+void introSortNetworkAll(vector<int>& arr) {
+    introSortNetwork(arr, 0, (int)arr.size() - 1);
+}
+
+// Template engines instantiated for int
+void mergeSortGenericAll(vector<int>& arr) {
+    mergeSortGeneric(arr.begin(), arr.end());
+}
+
+void quickSortGenericAll(vector<int>& arr) {
+    quickSortGeneric(arr.begin(), arr.end());
+}
+
+void sortGenericAll(vector<int>& arr) {
+    sortGeneric(arr.begin(), arr.end());
+}
+
+// All sorting engines by name
+struct SortAlgorithm {
+    const char* name;
+    void (*sort)(vector<int>&);
+    bool quadratic;            // O(n²) on every input
+    bool quadraticWorstCase;   // O(n²) and O(n) recursion depth on sorted or duplicate-heavy input
+    void (*sortWithPool)(vector<int>&, WorkStealingPool&);   // Parallel engines only
+};
+
+const vector<SortAlgorithm>& sortAlgorithms() {
+    static const vector<SortAlgorithm> algorithms = {
+        {"bubble", bubbleSort, true, true, nullptr},
+        {"insertion", insertionSort, true, true, nullptr},
+        {"selection", selectionSort, true, true, nullptr},
+        {"merge", mergeSortAll, false, false, nullptr},
+        {"merge-bu", mergeSortBottomUp, false, false, nullptr},
+        {"merge-simd", mergeSortNetwork, false, false, nullptr},
+        {"quick", quickSortAll, false, true, nullptr},
+        {"quick-block", quickSortBlockAll, false, true, nullptr},
+        {"introsort", introSortAll, false, false, nullptr},
+        {"introsort-simd", introSortNetworkAll, false, false, nullptr},
+        {"radix", radixSort, false, false, nullptr},
+        {"timsort", timSort, false, false, nullptr},
+        {"parallel-merge", parallelMergeSort, false, false, parallelMergeSort},
+        {"sample", parallelSampleSort, false, false, parallelSampleSort},
+        {"merge-generic", mergeSortGenericAll, false, false, nullptr},
+        {"quick-generic", quickSortGenericAll, false, false, nullptr},
+        {"sort-generic", sortGenericAll, false, false, nullptr},
+    };
+    return algorithms;
+}
+
+const SortAlgorithm* findSortAlgorithm(const string& name) {
+    for (const SortAlgorithm& algorithm : sortAlgorithms()) {
+        if (name == algorithm.name) return &algorithm;
+    }
+    return nullptr;
+}
+
+// Function to measure execution time
+double measureTime(void (*sortFunc)(vector<int>&), vector<int> arr) {
+    auto start = high_resolution_clock::now();
+    sortFunc(arr);
+    auto stop = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(stop - start);
+    return duration.count() / 1000.0;  // Convert to milliseconds
+}
+
+// Same, and clears sorted if the output is out of order
+double measureTime(void (*sortFunc)(vector<int>&), vector<int> arr, bool& sorted) {
+    auto start = high_resolution_clock::now();
+    sortFunc(arr);
+    auto stop = high_resolution_clock::now();
+    sorted = sorted && is_sorted(arr.begin(), arr.end());
+    return duration_cast<microseconds>(stop - start).count() / 1000.0;
+}
+
+double measureTimeMerge(void (*sortFunc)(vector<int>&, int, int), vector<int> arr) {
+    auto start = high_resolution_clock::now();
+    sortFunc(arr, 0, arr.size() - 1);
+    auto stop = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(stop - start);
+    return duration.count() / 1000.0;
+}
+
+double measureTimeQuick(void (*sortFunc)(vector<int>&, int, int), vector<int> arr) {
+    auto start = high_resolution_clock::now();
+    sortFunc(arr, 0, arr.size() - 1);
+    auto stop = high_resolution_clock::now();
+    auto duration = duration_cast<microseconds>(stop - start);
+    return duration.count() / 1000.0;
+}
+
+double measureTimeQuick(void (*sortFunc)(vector<int>&, int, int), vector<int> arr, bool& sorted) {
+    auto start = high_resolution_clock::now();
+    sortFunc(arr, 0, arr.size() - 1);
+    auto stop = high_resolution_clock::now();
+    sorted = sorted && is_sorted(arr.begin(), arr.end());
+    return duration_cast<microseconds>(stop - start).count() / 1000.0;
+}
+
+// Thread scaling of parallel merge sort: 1, 2, 4, ... N threads
+void runParallelBenchmark(int size, int maxThreads) {
+    cout << "Parallel Merge Sort (" << size << " elements, "
+         << hardwareThreads() << " hardware threads)\n" << endl;
+    
+    vector<int> threadCounts;
+    for (int t = 1; t < maxThreads; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(maxThreads);
+    
+    vector<int> arr = generateRandomArray(size);
+    double sequentialTime = measureTime(mergeSortBottomUp, arr);
+    
+    cout << setw(15) << "Threads" << setw(15) << "Time" << setw(18)
+         << "Throughput" << setw(15) << "Speedup" << endl;
+    cout << string(63, '-') << endl;
+    cout << setw(15) << "sequential" << setw(12) << fixed << setprecision(2)
+         << sequentialTime << " ms" << setw(12)
+         << size / max(sequentialTime, 0.001) / 1000.0 << " M/s" << setw(14) << 1.0 << "x" << endl;
+    
+    for (int threads : threadCounts) {
+        WorkStealingPool pool(threads);
+        vector<int> copyArr = arr;
+        
+        auto start = high_resolution_clock::now();
+        parallelMergeSort(copyArr, pool);
+        auto stop = high_resolution_clock::now();
+        double time = duration_cast<microseconds>(stop - start).count() / 1000.0;
+        
+        if (!is_sorted(copyArr.begin(), copyArr.end())) {
+            cout << "Error: parallel merge sort produced unsorted output" << endl;
+            return;
+        }
+        
+        cout << setw(15) << threads << setw(12) << time << " ms" << setw(12)
+             << size / max(time, 0.001) / 1000.0 << " M/s" << setw(14)
+             << sequentialTime / max(time, 0.001) << "x" << endl;
+    }
+    
+    cout << "\nNote: Throughput is in millions of elements per second" << endl;
+}
+
+// Physical memory in bytes (0 if unknown)
+long long physicalMemory() {
+#if defined(_SC_PHYS_PAGES) && defined(_SC_PAGE_SIZE)
+    long pages = sysconf(_SC_PHYS_PAGES);
+    long pageSize = sysconf(_SC_PAGE_SIZE);
+    if (pages > 0 && pageSize > 0) return (long long)pages * pageSize;
+#endif
+    return 0;
+}
+
+// Sample sort against the other large-array engines, sizes x10 up to maxSize
+void runSampleSortBenchmark(long long maxSize) {
+    // Input, working copy, buffer (4 bytes each) and the oracle (2 bytes)
+    const long long bytesPerElement = 14;
+    long long memory = physicalMemory();
+    if (maxSize <= 0) {
+        maxSize = (memory > 0) ? memory / 2 / bytesPerElement : 100000000;
+    }
+    maxSize = min(maxSize, (long long)2000000000);
+    
+    cout << "Parallel Sample Sort (" << hardwareThreads() << " hardware threads, up to "
+         << maxSize << " elements)\n" << endl;
+    
+    const char* distributions[] = {"random", "few-unique", "skewed"};
+    const char* names[] = {"Introsort", "Radix", "Parallel Merge", "Sample Sort"};
+    
+    cout << setw(12) << "Input" << setw(14) << "Array Size";
+    for (const char* name : names) cout << setw(17) << name;
+    cout << endl;
+    cout << string(94, '-') << endl;
+    
+    for (const char* dist : distributions) {
+        for (long long size = 100000; size <= maxSize; size *= 10) {
+            vector<int> arr;
+            string distName = dist;
+            if (distName == "random") arr = generateRandomArray(size);
+            else if (distName == "few-unique") arr = generateFewUniqueArray(size, 16);
+            else arr = generateSkewedArray(size);
+            
+            cout << setw(12) << dist << setw(14) << size << fixed << setprecision(2);
+            for (int engine = 0; engine < 4; engine++) {
+                vector<int> copyArr = arr;
+                auto start = high_resolution_clock::now();
+                switch (engine) {
+                    case 0: introSort(copyArr, 0, copyArr.size() - 1); break;
+                    case 1: radixSort(copyArr); break;
+                    case 2: parallelMergeSort(copyArr); break;
+                    default: parallelSampleSort(copyArr); break;
+                }
+                auto stop = high_resolution_clock::now();
+                double time = duration_cast<microseconds>(stop - start).count() / 1000.0;
+                
+                if (!is_sorted(copyArr.begin(), copyArr.end())) {
+                    cout << setw(17) << "unsorted!";
+                } else {
+                    cout << setw(14) << time << " ms";
+                }
+            }
+            cout << endl;
+        }
+    }
+    
+    cout << "\nNote: Times are in milliseconds (ms)" << endl;
+}
+
+// In-memory engine by name (used for external sort runs)
+bool findSortEngine(const string& name, void (*&sortFunc)(vector<int>&)) {
+    const SortAlgorithm* algorithm = findSortAlgorithm(name);
+    if (!algorithm) return false;
+    sortFunc = algorithm->sort;
+    return true;
+}
+
+// External merge sort of a binary file of 32-bit ints
+int runExternalSort(const string& input, const string& output, long long memoryMB,
+                    int fanIn, const string& engine) {
+    void (*sortFunc)(vector<int>&) = nullptr;
+    if (!findSortEngine(engine, sortFunc)) {
+        cout << "Unknown engine: " << engine << endl;
+        return 1;
+    }
+    
+    cout << "External Merge Sort" << endl;
+    cout << "Input: " << input << ", output: " << output << endl;
+    cout << "Memory: " << memoryMB << " MB, max fan-in: " << fanIn
+         << ", run engine: " << engine << "\n" << endl;
+    
+    ExternalSortStats stats;
+    string error;
+    if (!externalSort(input, output, memoryMB * 1024 * 1024, fanIn, sortFunc, stats, error)) {
+        cout << "Error: " << error << endl;
+        return 1;
+    }
+    
+    double inputMB = stats.elements * sizeof(int) / (1024.0 * 1024.0);
+    double readMB = stats.bytesRead / (1024.0 * 1024.0);
+    double writtenMB = stats.bytesWritten / (1024.0 * 1024.0);
+    double totalMs = stats.runFormationMs + stats.mergeMs;
+    
+    cout << fixed << setprecision(2);
+    cout << "Elements:        " << stats.elements << " (" << inputMB << " MB)" << endl;
+    cout << "Runs:            " << stats.runs << endl;
+    cout << "Merge fan-in:    " << stats.fanIn << endl;
+    cout << "Merge passes:    " << stats.mergePasses << endl;
+    cout << "Bytes read:      " << readMB << " MB" << endl;
+    cout << "Bytes written:   " << writtenMB << " MB" << endl;
+    if (inputMB > 0) {
+        cout << "I/O volume:      " << (readMB + writtenMB) / inputMB << "x input size" << endl;
+    }
+    cout << "Run formation:   " << stats.runFormationMs << " ms" << endl;
+    cout << "Merge:           " << stats.mergeMs << " ms" << endl;
+    cout << "Total:           " << totalMs << " ms ("
+         << inputMB / max(totalMs / 1000.0, 0.001) << " MB/s)" << endl;
+    return 0;
+}
+
+// Sorting-network kernels vs insertion sort, and their effect as base cases
+void runSimdBenchmark() {
+    cout << "Sorting-network base case (kernels: " << simdKernelName() << ")\n" << endl;
+    
+    // Kernel: sort many independent small blocks
+    const int totalElements = 1 << 22;
+    vector<int> data = generateRandomArray(totalElements);
+    
+    cout << setw(15) << "Block Size" << setw(18) << "Insertion" << setw(18)
+         << "Network" << setw(15) << "Speedup" << endl;
+    cout << string(66, '-') << endl;
+    
+    vector<int> blockSizes = {8, 16, 32, 64};
+    for (int block : blockSizes) {
+        vector<int> a = data, b = data;
+        
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i + block <= totalElements; i += block) sortSmallScalar(a.data() + i, block);
+        double insertionTime = duration_cast<microseconds>(high_resolution_clock::now() - start).count() / 1000.0;
+        
+        start = high_resolution_clock::now();
+        for (int i = 0; i + block <= totalElements; i += block) sortSmall(b.data() + i, block);
+        double networkTime = duration_cast<microseconds>(high_resolution_clock::now() - start).count() / 1000.0;
+        
+        if (a != b) {
+            cout << "Error: network kernel disagrees with insertion sort" << endl;
+            return;
+        }
+        
+        double blocks = totalElements / block;
+        cout << setw(15) << block << fixed << setprecision(2)
+             << setw(13) << insertionTime * 1e6 / blocks << " ns/b"
+             << setw(13) << networkTime * 1e6 / blocks << " ns/b"
+             << setw(14) << insertionTime / max(networkTime, 0.001) << "x" << endl;
+    }
+    
+    // Full sorts with and without the network base case
+    cout << "\n" << setw(15) << "Array Size" << setw(15) << "Merge (BU)" << setw(15)
+         << "Merge (SIMD)" << setw(15) << "Introsort" << setw(18) << "Introsort (SIMD)" << endl;
+    cout << string(78, '-') << endl;
+    
+    vector<int> sizes = {10000, 100000, 1000000, 10000000};
+    for (int size : sizes) {
+        vector<int> arr = generateRandomArray(size);
+        
+        bool sorted = true;
+        double mergeTime = measureTime(mergeSortBottomUp, arr, sorted);
+        double mergeSimdTime = measureTime(mergeSortNetwork, arr, sorted);
+        double introTime = measureTimeQuick(introSort, arr, sorted);
+        double introSimdTime = measureTimeQuick(introSortNetwork, arr, sorted);
+        
+        cout << setw(15) << size << fixed << setprecision(2)
+             << setw(12) << mergeTime << " ms"
+             << setw(12) << mergeSimdTime << " ms"
+             << setw(12) << introTime << " ms"
+             << setw(15) << introSimdTime << " ms" << (sorted ? "" : "  (unsorted output!)") << endl;
+    }
+    
+    cout << "\nNote: ns/b = nanoseconds per block" << endl;
+}
+
+// Adaptive sort vs merge sort on presorted inputs
+void runPresortedBenchmark(int size) {
+    cout << "Timsort vs Merge Sort on presorted input (" << size << " elements)\n" << endl;
+    
+    vector<int> sorted = generateRandomArray(size);
+    sort(sorted.begin(), sorted.end());
+    mt19937 gen(size);
+    uniform_int_distribution<int> position(0, max(size - 1, 0));
+    
+    const char* names[] = {"Merge", "Merge (BU)", "Introsort", "Timsort"};
+    void (*engines[])(vector<int>&) = {mergeSortAll, mergeSortBottomUp, introSortAll, timSort};
+    
+    cout << setw(22) << "Input";
+    for (const char* name : names) cout << setw(15) << name;
+    cout << endl;
+    cout << string(82, '-') << endl;
+    
+    // Small sizes make size / 100 one of the fixed counts: print each count once
+    vector<int> swapCounts = {0, 10, 1000, size / 100};
+    sort(swapCounts.begin(), swapCounts.end());
+    swapCounts.erase(unique(swapCounts.begin(), swapCounts.end()), swapCounts.end());
+    for (int input = -2; input < (int)swapCounts.size(); input++) {
+        vector<int> arr = sorted;
+        string label;
+        if (input == -2) {
+            arr = generateRandomArray(size);
+            label = "random";
+        } else if (input == -1) {
+            reverse(arr.begin(), arr.end());
+            label = "reversed";
+        } else if (swapCounts[input] == 0) {
+            label = "sorted";
+        } else {
+            for (int k = 0; k < swapCounts[input]; k++) {
+                swap(arr[position(gen)], arr[position(gen)]);
+            }
+            label = "sorted + " + to_string(swapCounts[input]) + " swaps";
+        }
+        
+        bool sorted = true;
+        cout << setw(22) << label << fixed << setprecision(2);
+        for (auto engine : engines) {
+            cout << setw(12) << measureTime(engine, arr, sorted) << " ms";
+        }
+        cout << (sorted ? "" : "  (unsorted output!)") << endl;
+    }
+    
+    cout << "\nNote: Times are in milliseconds (ms)" << endl;
+}
+
+// Struct sorted by one of its fields in --generic mode
+struct Record {
+    long long timestamp;
+    float score;
+    string name;
+    int id;
+};
+
+vector<Record> generateRecords(int size) {
+    vector<Record> records(size);
+    mt19937_64 gen(inputSeed + size);
+    uniform_int_distribution<long long> time(0, 1LL << 50);
+    normal_distribution<float> score(0.0f, 100.0f);
+    uniform_int_distribution<int> letter('a', 'z'), length(6, 14);
+    
+    for (int i = 0; i < size; i++) {
+        records[i].timestamp = time(gen);
+        records[i].score = score(gen);
+        records[i].name.resize(length(gen));
+        for (char& c : records[i].name) c = (char)letter(gen);
+        records[i].id = i;
+    }
+    return records;
+}
+
+bool compareTimestamp(const Record& a, const Record& b) { return a.timestamp < b.timestamp; }
+bool compareScore(const Record& a, const Record& b) { return a.score < b.score; }
+bool compareName(const Record& a, const Record& b) { return a.name < b.name; }
+bool compareInt(const int& a, const int& b) { return a < b; }
+
+// The sorter is a template parameter, so it is instantiated (and inlined) directly
+template <typename T, typename Sorter>
+double measureTimeGeneric(Sorter sorter, vector<T> arr, bool (*less)(const T&, const T&), bool& sorted) {
+    auto start = high_resolution_clock::now();
+    sorter(arr);
+    auto stop = high_resolution_clock::now();
+    sorted = sorted && is_sorted(arr.begin(), arr.end(), less);
+    return duration_cast<microseconds>(stop - start).count() / 1000.0;
+}
+
+// One table row: the same key sorted by each engine
+template <typename T, typename Projection>
+void runGenericRow(const string& label, const vector<T>& input, Projection proj,
+                   bool (*less)(const T&, const T&)) {
+    bool sorted = true;
+    auto lessByKey = [proj](const T& a, const T& b) { return proj(a) < proj(b); };
+    
+    cout << setw(18) << label << fixed << setprecision(2);
+    cout << setw(12) << measureTimeGeneric([lessByKey](vector<T>& v) {
+        sort(v.begin(), v.end(), lessByKey);
+    }, input, less, sorted) << " ms";
+    cout << setw(12) << measureTimeGeneric([less](vector<T>& v) {
+        quickSortGeneric(v.begin(), v.end(), less);
+    }, input, less, sorted) << " ms";
+    cout << setw(12) << measureTimeGeneric([proj](vector<T>& v) {
+        quickSortGeneric(v.begin(), v.end(), LessThan(), proj);
+    }, input, less, sorted) << " ms";
+    cout << setw(12) << measureTimeGeneric([proj](vector<T>& v) {
+        mergeSortGeneric(v.begin(), v.end(), LessThan(), proj);
+    }, input, less, sorted) << " ms";
+    cout << setw(12) << measureTimeGeneric([proj](vector<T>& v) {
+        sortGeneric(v.begin(), v.end(), LessThan(), proj);
+    }, input, less, sorted) << " ms";
+    cout << (sorted ? "" : "  (unsorted output!)") << endl;
+}
+
+// Template sorts with inlined comparators and key projections on struct fields
+void runGenericBenchmark(int size) {
+    cout << "Generic sorts by key (" << size << " elements)\n" << endl;
+    cout << setw(18) << "Key" << setw(15) << "std::sort" << setw(15) << "Quick (ptr)"
+         << setw(15) << "Quick" << setw(15) << "Merge" << setw(15) << "Auto" << endl;
+    cout << string(93, '-') << endl;
+    
+    vector<int> ints = generateInput("random", size, inputSeed);
+    runGenericRow("int", ints, Identity(), compareInt);
+    
+    vector<Record> records = generateRecords(size);
+    runGenericRow("int64 timestamp", records, [](const Record& r) { return r.timestamp; }, compareTimestamp);
+    runGenericRow("float score", records, [](const Record& r) { return r.score; }, compareScore);
+    runGenericRow("string name", records, [](const Record& r) -> const string& { return r.name; }, compareName);
+    
+    cout << "\nQuick (ptr): comparator passed as a function pointer" << endl;
+    cout << "Quick, Merge: comparator and projection inlined" << endl;
+    cout << "Auto: radix sort for arithmetic keys, introsort otherwise (chosen at compile time)" << endl;
+}
+
+// Record of Bytes bytes: a 64-bit key followed by the payload
+template <int Bytes>
+struct PayloadRecord {
+    long long key;
+    char payload[Bytes - sizeof(long long)];
+    
+    static bool less(const PayloadRecord& a, const PayloadRecord& b) { return a.key < b.key; }
+};
+
+double elapsedSince(high_resolution_clock::time_point start) {
+    return duration_cast<microseconds>(high_resolution_clock::now() - start).count() / 1000.0;
+}
+
+// Direct sorts (records moved by every partition/merge step) vs key-index sort
+template <int Bytes>
+void runIndirectRow(int size) {
+    typedef PayloadRecord<Bytes> Rec;
+    vector<Rec> input(size);
+    mt19937_64 gen(inputSeed + size);
+    for (int i = 0; i < size; i++) {
+        input[i].key = (long long)(gen() >> 1);
+        fill(input[i].payload, input[i].payload + sizeof(input[i].payload), (char)i);
+    }
+    
+    auto key = [](const Rec& r) { return r.key; };
+    auto keyLess = [](long long a, long long b) { return a < b; };  // Disables the radix fast path
+    bool sorted = true;
+    
+    cout << setw(10) << Bytes << " B" << fixed << setprecision(2);
+    cout << setw(11) << measureTimeGeneric([](vector<Rec>& v) {
+        sort(v.begin(), v.end(), Rec::less);
+    }, input, Rec::less, sorted) << " ms";
+    cout << setw(11) << measureTimeGeneric([key](vector<Rec>& v) {
+        quickSortGeneric(v.begin(), v.end(), LessThan(), key);
+    }, input, Rec::less, sorted) << " ms";
+    cout << setw(11) << measureTimeGeneric([key](vector<Rec>& v) {
+        mergeSortGeneric(v.begin(), v.end(), LessThan(), key);
+    }, input, Rec::less, sorted) << " ms";
+    cout << setw(11) << measureTimeGeneric([key, keyLess](vector<Rec>& v) {
+        indirectSortGeneric(v.begin(), v.end(), keyLess, key);
+    }, input, Rec::less, sorted) << " ms";
+    
+    // Radix key-index sort, split into computing and applying the permutation
+    vector<Rec> work = input;
+    auto start = high_resolution_clock::now();
+    vector<uint32_t> order = argsortGeneric(work.begin(), work.end(), LessThan(), key);
+    double argsortTime = elapsedSince(start);
+    start = high_resolution_clock::now();
+    applyPermutation(work.begin(), work.end(), std::move(order));
+    double applyTime = elapsedSince(start);
+    sorted = sorted && is_sorted(work.begin(), work.end(), Rec::less);
+    
+    cout << setw(11) << argsortTime << " ms" << setw(11) << applyTime << " ms"
+         << setw(11) << argsortTime + applyTime << " ms" << (sorted ? "" : "  (unsorted output!)") << endl;
+}
+
+// Sorting large records directly vs through a (key, index) argsort
+void runIndirectBenchmark(int size) {
+    cout << "Key-index sort of records with a 64-bit key (" << size << " records)\n" << endl;
+    cout << setw(12) << "Record" << setw(14) << "std::sort" << setw(14) << "Quick" << setw(14) << "Merge"
+         << setw(14) << "Index (cmp)" << setw(14) << "Argsort" << setw(14) << "Apply"
+         << setw(14) << "Index (radix)" << endl;
+    cout << string(110, '-') << endl;
+    
+    runIndirectRow<16>(size);
+    runIndirectRow<64>(size);
+    runIndirectRow<128>(size);
+    runIndirectRow<256>(size);
+    
+    cout << "\nstd::sort, Quick, Merge: records are moved by every partition/merge step" << endl;
+    cout << "Index (cmp): (key, index) arrays merge sorted, then each record moved once" << endl;
+    cout << "Argsort + Apply = Index (radix): radix sort of the key/index arrays, then the permutation" << endl;
+}
+
+// Selection vs full sort at various k
+void runSelectionBenchmark(int size) {
+    cout << "Selection vs full sort (" << size << " random elements, k smallest, "
+         << hardwareThreads() << " hardware threads)\n" << endl;
+    
+    vector<int> input = generateInput("random", size, inputSeed);
+    vector<int> work = input;
+    auto start = high_resolution_clock::now();
+    introSort(work, 0, size - 1);
+    double fullTime = elapsedSince(start);
+    vector<int> reference = work;
+    cout << "Full sort (introsort): " << fixed << setprecision(2) << fullTime << " ms\n" << endl;
+    
+    cout << setw(12) << "k" << setw(15) << "nth element" << setw(15) << "Partial" << setw(15)
+         << "std::partial" << setw(15) << "Heap stream" << setw(15) << "Parallel" << setw(13) << "Saving" << endl;
+    cout << string(100, '-') << endl;
+    
+    vector<int> ks = {1, 10, 100, 1000, 10000, 100000, 1000000, size / 2, size};
+    int previous = 0;
+    for (int k : ks) {
+        if (k <= previous || k > size) continue;
+        previous = k;
+        bool correct = true;
+        
+        work = input;
+        start = high_resolution_clock::now();
+        nthElement(work, k - 1);
+        double nthTime = elapsedSince(start);
+        correct = correct && work[k - 1] == reference[k - 1];
+        
+        work = input;
+        start = high_resolution_clock::now();
+        partialSort(work, k);
+        double partialTime = elapsedSince(start);
+        correct = correct && equal(work.begin(), work.begin() + k, reference.begin());
+        
+        work = input;
+        start = high_resolution_clock::now();
+        partial_sort(work.begin(), work.begin() + k, work.end());
+        double stdTime = elapsedSince(start);
+        
+        start = high_resolution_clock::now();
+        StreamingTopK topK(k);
+        for (int value : input) topK.push(value);
+        vector<int> streamed = topK.sorted();
+        double streamTime = elapsedSince(start);
+        correct = correct && equal(streamed.begin(), streamed.end(), reference.begin());
+        
+        work = input;
+        start = high_resolution_clock::now();
+        parallelPartialSort(work, k);
+        double parallelTime = elapsedSince(start);
+        correct = correct && equal(work.begin(), work.begin() + k, reference.begin());
+        
+        cout << setw(12) << k << setw(12) << nthTime << " ms" << setw(12) << partialTime << " ms"
+             << setw(12) << stdTime << " ms" << setw(12) << streamTime << " ms"
+             << setw(12) << parallelTime << " ms" << setw(12) << fullTime / max(partialTime, 0.01) << "x"
+             << (correct ? "" : "  (wrong result!)") << endl;
+    }
+    
+    cout << "\nnth element: introselect (k-th smallest in place, neighbours partitioned)" << endl;
+    cout << "Partial: heap select for k <= n / " << PARTIAL_HEAP_RATIO
+         << ", else introselect + introsort of the k-prefix; Saving = full sort / Partial" << endl;
+    cout << "Heap stream: bounded max-heap of k, one pass, O(k) memory" << endl;
+    cout << "Parallel: introselect + parallel merge sort of the k-prefix" << endl;
+}
+
+// Streaming top-k over a binary file that need not fit in memory
+int runSelectFile(const string& path, int k) {
+    vector<int> result;
+    long long count = 0;
+    auto start = high_resolution_clock::now();
+    if (!streamingTopKFile(path, k, result, count)) {
+        cout << "Error: cannot read " << path << endl;
+        return 1;
+    }
+    double time = elapsedSince(start);
+    
+    cout << "Streaming top-k of " << path << " (" << count << " values, k = " << k << ")" << endl;
+    cout << "Time: " << fixed << setprecision(2) << time << " ms, memory: "
+         << result.size() * sizeof(int) / 1024.0 << " KB" << endl;
+    if (!result.empty()) {
+        cout << "Smallest: " << result.front() << ", k-th smallest: " << result.back() << endl;
+    }
+    return 0;
+}
+
+// Above this size, algorithms that can go quadratic are skipped
+const int QUADRATIC_SIZE_LIMIT = 50000;
+
+vector<string> splitList(const string& text) {
+    vector<string> items;
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+// Time one sort in nanoseconds (sortFunc: function pointer or lambda)
+template <typename Sorter>
+double timeSortNs(Sorter sortFunc, const vector<int>& input, vector<int>& work) {
+    work = input;
+    auto start = steady_clock::now();
+    sortFunc(work);
+    auto stop = steady_clock::now();
+    return (double)duration_cast<nanoseconds>(stop - start).count();
+}
+
+// Statistically rigorous benchmark: warmups, repeated trials, fixed seed
+int runBenchmarkMode(int argc, char* argv[]) {
+    vector<string> algorithms, distributions = {"random"};
+    vector<long long> sizes = {100000};
+    int trials = 10, warmup = 2;
+    string format = "table", outPath;
+    
+    for (int i = 2; i < argc; i++) {
+        string option = argv[i];
+        if (i + 1 >= argc) {
+            cerr << "Missing value for " << option << endl;
+            return 1;
+        }
+        string value = argv[++i];
+        if (option == "--algos") algorithms = splitList(value);
+        else if (option == "--dist") distributions = splitList(value);
+        else if (option == "--sizes") {
+            sizes.clear();
+            for (const string& size : splitList(value)) sizes.push_back(atoll(size.c_str()));
+        }
+        else if (option == "--trials") trials = max(1, atoi(value.c_str()));
+        else if (option == "--warmup") warmup = max(0, atoi(value.c_str()));
+        else if (option == "--seed") inputSeed = (unsigned int)strtoul(value.c_str(), nullptr, 10);
+        else if (option == "--format") format = value;
+        else if (option == "--out") outPath = value;
+        else {
+            cerr << "Unknown option: " << option << endl;
+            return 1;
+        }
+    }
+    
+    if (algorithms.empty()) {
+        for (const SortAlgorithm& algorithm : sortAlgorithms()) algorithms.push_back(algorithm.name);
+    }
+    for (const string& name : algorithms) {
+        if (!findSortAlgorithm(name)) {
+            cerr << "Unknown algorithm: " << name << endl;
+            return 1;
+        }
+    }
+    for (const string& dist : distributions) {
+        if (!isInputDistribution(dist)) {
+            cerr << "Unknown distribution: " << dist << endl;
+            return 1;
+        }
+    }
+    if (format != "table" && format != "csv" && format != "json") {
+        cerr << "Unknown format: " << format << endl;
+        return 1;
+    }
+    
+    // Progress goes to stderr so stdout stays machine-readable
+    cerr << "Benchmark: " << trials << " trials, " << warmup << " warmup runs, seed "
+         << inputSeed << endl;
+    
+    vector<BenchResult> results;
+    vector<int> work;
+    for (const string& dist : distributions) {
+        for (long long size : sizes) {
+            vector<int> input = generateInput(dist, (int)size, inputSeed);
+            
+            for (const string& name : algorithms) {
+                const SortAlgorithm* algorithm = findSortAlgorithm(name);
+                bool risky = algorithm->quadratic || (algorithm->quadraticWorstCase && dist != "random");
+                if (risky && size > QUADRATIC_SIZE_LIMIT) {
+                    cerr << "  skipping " << name << " on " << dist << " (" << size
+                         << " elements): quadratic" << endl;
+                    continue;
+                }
+                
+                BenchResult result;
+                result.algorithm = name;
+                result.distribution = dist;
+                result.size = size;
+                result.seed = inputSeed;
+                
+                for (int run = 0; run < warmup; run++) timeSortNs(algorithm->sort, input, work);
+                for (int run = 0; run < trials; run++) {
+                    result.samplesNs.push_back(timeSortNs(algorithm->sort, input, work));
+                }
+                if (!is_sorted(work.begin(), work.end())) {
+                    cerr << "Error: " << name << " produced unsorted output" << endl;
+                    return 1;
+                }
+                
+                computeStats(result);
+                results.push_back(result);
+                cerr << "  " << name << " / " << dist << " / " << size << " done" << endl;
+            }
+        }
+    }
+    
+    ofstream file;
+    if (!outPath.empty()) {
+        file.open(outPath);
+        if (!file) {
+            cerr << "Error: cannot write " << outPath << endl;
+            return 1;
+        }
+    }
+    ostream& out = outPath.empty() ? cout : file;
+    
+    if (format == "csv") {
+        writeCsv(out, results);
+    } else if (format == "json") {
+        writeJson(out, results);
+    } else {
+        out << setw(16) << "Algorithm" << setw(13) << "Input" << setw(12) << "Size"
+            << setw(13) << "Min (ms)" << setw(13) << "Median (ms)" << setw(13) << "p95 (ms)"
+            << setw(14) << "M elem/s" << endl;
+        out << string(94, '-') << endl;
+        for (const BenchResult& r : results) {
+            out << setw(16) << r.algorithm << setw(13) << r.distribution << setw(12) << r.size
+                << fixed << setprecision(3)
+                << setw(13) << r.minNs / 1e6 << setw(13) << r.medianNs / 1e6 << setw(13) << r.p95Ns / 1e6
+                << setprecision(2) << setw(14) << r.elementsPerSecond() / 1e6 << endl;
+        }
+        out << "\nSeed: " << inputSeed << ", trials: " << trials << ", warmup: " << warmup << endl;
+    }
+    return 0;
+}
+
+// Median-of-trials measurement of one sweep point
+// Returns false (after reporting it) if the sort produced unsorted output
+template <typename Sorter>
+bool measureSweepPoint(const string& mode, const string& name, const string& dist,
+                       const vector<int>& input, int threads, int trials, Sorter sorter,
+                       SweepResult& result) {
+    result = SweepResult();
+    result.mode = mode;
+    result.threads = threads;
+    result.bench.algorithm = name;
+    result.bench.distribution = dist;
+    result.bench.size = input.size();
+    result.bench.seed = inputSeed;
+    
+    vector<int> work;
+    for (int run = 0; run < trials; run++) {
+        result.bench.samplesNs.push_back(timeSortNs(sorter, input, work));
+    }
+    computeStats(result.bench);
+    if (!is_sorted(work.begin(), work.end())) {
+        cerr << "Error: " << name << " produced unsorted output" << endl;
+        return false;
+    }
+    return true;
+}
+
+// Size and thread scaling sweep: geometric sizes up to a memory budget,
+// algorithms dropped once their next size would exceed the time budget
+int runSweepMode(int argc, char* argv[]) {
+    // Input, working copy, scratch buffer (4 bytes each) and sample sort's oracle (2 bytes)
+    const long long bytesPerElement = 14;
+    
+    vector<string> algorithms;
+    vector<int> threadCounts;
+    string dist = "random", format = "table", outPath;
+    long long minSize = 1000, maxSize = 0, memoryMB = 0, weakSize = 1000000;
+    double factor = 10, timeBudget = 2.0;
+    int trials = 3;
+    
+    for (int i = 2; i < argc; i++) {
+        string option = argv[i];
+        if (i + 1 >= argc) {
+            cerr << "Missing value for " << option << endl;
+            return 1;
+        }
+        string value = argv[++i];
+        if (option == "--algos") algorithms = splitList(value);
+        else if (option == "--dist") dist = value;
+        else if (option == "--min-size") minSize = max(1LL, atoll(value.c_str()));
+        else if (option == "--max-size") maxSize = atoll(value.c_str());
+        else if (option == "--factor") factor = max(1.1, atof(value.c_str()));
+        else if (option == "--memory") memoryMB = atoll(value.c_str());
+        else if (option == "--time-budget") timeBudget = atof(value.c_str());
+        else if (option == "--threads") {
+            for (const string& count : splitList(value)) threadCounts.push_back(max(1, atoi(count.c_str())));
+        }
+        else if (option == "--weak-size") weakSize = max(1LL, atoll(value.c_str()));
+        else if (option == "--trials") trials = max(1, atoi(value.c_str()));
+        else if (option == "--seed") inputSeed = (unsigned int)strtoul(value.c_str(), nullptr, 10);
+        else if (option == "--format") format = value;
+        else if (option == "--out") outPath = value;
+        else {
+            cerr << "Unknown option: " << option << endl;
+            return 1;
+        }
+    }
+    
+    if (algorithms.empty()) {
+        for (const SortAlgorithm& algorithm : sortAlgorithms()) algorithms.push_back(algorithm.name);
+    }
+    for (const string& name : algorithms) {
+        if (!findSortAlgorithm(name)) {
+            cerr << "Unknown algorithm: " << name << endl;
+            return 1;
+        }
+    }
+    if (!isInputDistribution(dist)) {
+        cerr << "Unknown distribution: " << dist << endl;
+        return 1;
+    }
+    if (format != "table" && format != "csv") {
+        cerr << "Unknown format: " << format << endl;
+        return 1;
+    }
+    
+    // Thread counts: 1, 2, 4, ... hardware threads unless given (1 is always measured)
+    if (threadCounts.empty()) {
+        for (int threads = 1; threads < hardwareThreads(); threads *= 2) threadCounts.push_back(threads);
+        threadCounts.push_back(hardwareThreads());
+    }
+    threadCounts.push_back(1);
+    sort(threadCounts.begin(), threadCounts.end());
+    threadCounts.erase(unique(threadCounts.begin(), threadCounts.end()), threadCounts.end());
+    
+    // Sizes: minSize * factor^i up to the memory budget (and the int index range)
+    long long memoryBytes = (memoryMB > 0) ? memoryMB * 1024 * 1024 : physicalMemory() / 2;
+    if (memoryBytes <= 0) memoryBytes = 1LL << 30;
+    long long sizeLimit = min(memoryBytes / bytesPerElement, (long long)INT_MAX / 2);
+    if (maxSize > 0) sizeLimit = min(sizeLimit, maxSize);
+    vector<long long> sizes;
+    for (double size = (double)minSize; (long long)size <= sizeLimit; size *= factor) {
+        sizes.push_back((long long)size);
+    }
+    
+    cerr << "Sweep: sizes " << minSize << " .. " << (sizes.empty() ? 0 : sizes.back()) << " (x" << factor
+         << ", memory budget " << memoryBytes / (1024 * 1024) << " MB), time budget " << timeBudget
+         << " s per run, " << trials << " trials" << endl;
+    
+    vector<SweepResult> results;
+    for (const string& name : algorithms) {
+        const SortAlgorithm* algorithm = findSortAlgorithm(name);
+        bool risky = algorithm->quadratic || (algorithm->quadraticWorstCase && dist != "random");
+        
+        for (long long size : sizes) {
+            if (risky && size > QUADRATIC_SIZE_LIMIT) {
+                cerr << "  " << name << ": stopping at " << size << " elements (quadratic on " << dist << ")" << endl;
+                break;
+            }
+            vector<int> input = generateInput(dist, (int)size, inputSeed);
+            
+            double slowestSeconds;
+            if (!algorithm->sortWithPool) {
+                SweepResult result;
+                if (!measureSweepPoint("size", name, dist, input, 1, trials, algorithm->sort, result)) return 1;
+                results.push_back(result);
+                slowestSeconds = results.back().bench.medianNs / 1e9;
+            } else {
+                // Strong scaling: same input on 1, 2, 4, ... threads
+                double oneThreadNs = 0;
+                for (int threads : threadCounts) {
+                    WorkStealingPool pool(threads);
+                    auto sorter = [&pool, algorithm](vector<int>& arr) { algorithm->sortWithPool(arr, pool); };
+                    SweepResult result;
+                    if (!measureSweepPoint("strong", name, dist, input, threads, trials, sorter, result)) return 1;
+                    if (threads == 1) oneThreadNs = result.bench.medianNs;
+                    result.speedup = oneThreadNs / max(result.bench.medianNs, 1.0);
+                    result.efficiency = result.speedup / threads;
+                    results.push_back(result);
+                }
+                slowestSeconds = oneThreadNs / 1e9;
+            }
+            cerr << "  " << name << " / " << size << " done" << endl;
+            
+            // Predict the next size: x factor^2 for quadratic growth, else n log n
+            double growth = risky ? factor * factor : factor * log(size * factor) / log((double)max(size, 2LL));
+            if (slowestSeconds * growth > timeBudget && size != sizes.back()) {
+                cerr << "  " << name << ": stopping after " << size << " elements (next size would exceed the "
+                     << timeBudget << " s time budget)" << endl;
+                break;
+            }
+        }
+        
+        // Weak scaling: weakSize elements per thread
+        if (algorithm->sortWithPool) {
+            double oneThreadNs = 0;
+            for (int threads : threadCounts) {
+                long long size = weakSize * threads;
+                if (size > sizeLimit) break;
+                vector<int> input = generateInput(dist, (int)size, inputSeed);
+                WorkStealingPool pool(threads);
+                auto sorter = [&pool, algorithm](vector<int>& arr) { algorithm->sortWithPool(arr, pool); };
+                SweepResult result;
+                if (!measureSweepPoint("weak", name, dist, input, threads, trials, sorter, result)) return 1;
+                if (threads == 1) oneThreadNs = result.bench.medianNs;
+                result.efficiency = oneThreadNs / max(result.bench.medianNs, 1.0);
+                result.speedup = result.efficiency * threads;
+                results.push_back(result);
+                
+                // The next thread count roughly doubles the size
+                if (result.bench.medianNs / 1e9 * 2 > timeBudget) break;
+            }
+            cerr << "  " << name << " weak scaling done" << endl;
+        }
+    }
+    
+    ofstream file;
+    if (!outPath.empty()) {
+        file.open(outPath);
+        if (!file) {
+            cerr << "Error: cannot write " << outPath << endl;
+            return 1;
+        }
+    }
+    ostream& out = outPath.empty() ? cout : file;
+    
+    if (format == "csv") {
+        writeSweepCsv(out, results);
+        return 0;
+    }
+    
+    out << setw(8) << "Mode" << setw(16) << "Algorithm" << setw(13) << "Size" << setw(9) << "Threads"
+        << setw(14) << "Median (ms)" << setw(12) << "M elem/s" << setw(10) << "Speedup" << setw(12)
+        << "Efficiency" << endl;
+    out << string(94, '-') << endl;
+    for (const SweepResult& r : results) {
+        out << setw(8) << r.mode << setw(16) << r.bench.algorithm << setw(13) << r.bench.size
+            << setw(9) << r.threads << fixed << setprecision(3) << setw(14) << r.bench.medianNs / 1e6
+            << setprecision(2) << setw(12) << r.bench.elementsPerSecond() / 1e6;
+        if (r.mode == "size") out << setw(10) << "-" << setw(12) << "-";
+        else out << setw(9) << r.speedup << "x" << setw(11) << r.efficiency * 100 << "%";
+        out << endl;
+    }
+    out << "\nstrong: fixed size, efficiency = T(1) / (threads * T(threads))" << endl;
+    out << "weak: " << weakSize << " elements per thread, efficiency = T(1) / T(threads)" << endl;
+    return 0;
+}
+
+int runCompareMode(int argc, char* argv[]) {
+    if (argc < 4) {
+        cerr << "Usage: " << argv[0] << " --compare <baseline> <current> [alpha] [threshold%]" << endl;
+        return 1;
+    }
+    vector<BenchResult> baseline, current;
+    if (!readResults(argv[2], baseline)) {
+        cerr << "Error: cannot read " << argv[2] << endl;
+        return 1;
+    }
+    if (!readResults(argv[3], current)) {
+        cerr << "Error: cannot read " << argv[3] << endl;
+        return 1;
+    }
+    double alpha = (argc > 4) ? atof(argv[4]) : 0.05;
+    double threshold = (argc > 5) ? atof(argv[5]) : 2.0;
+    
+    // Exit code 2 when there are significant regressions (for scripts)
+    return compareResults(baseline, current, alpha, threshold) > 0 ? 2 : 0;
+}
+
+// Time one sort with hardware counters running around it
+double measureCounters(void (*sortFunc)(vector<int>&), const vector<int>& input, vector<int>& work,
+                       PerfCounters& counters) {
+    work = input;
+    auto start = steady_clock::now();
+    counters.start();
+    sortFunc(work);
+    counters.stop();
+    auto stop = steady_clock::now();
+    return (double)duration_cast<nanoseconds>(stop - start).count();
+}
+
+// Per-element hardware counters next to the timings: shows whether an
+// engine is bound by branch mispredictions, cache misses or TLB misses
+int runCountersMode(int argc, char* argv[]) {
+    int size = (argc > 2) ? max(atoi(argv[2]), 1) : 1000000;
+    string dist = (argc > 3) ? argv[3] : "random";
+    vector<string> algorithms = (argc > 4) ? splitList(argv[4]) : vector<string>();
+    const int trials = 3;
+    
+    if (!isInputDistribution(dist)) {
+        cout << "Unknown distribution: " << dist << endl;
+        return 1;
+    }
+    if (algorithms.empty()) {
+        for (const SortAlgorithm& algorithm : sortAlgorithms()) algorithms.push_back(algorithm.name);
+    }
+    for (const string& name : algorithms) {
+        if (!findSortAlgorithm(name)) {
+            cout << "Unknown algorithm: " << name << endl;
+            return 1;
+        }
+    }
+    
+    PerfCounters counters;
+    cout << "Hardware counters per element (" << size << " elements, " << dist
+         << " input, best of " << trials << " runs)\n" << endl;
+    if (!counters.available()) {
+        cout << "Hardware counters unavailable (" << counters.lastError() << ")." << endl;
+        cout << "Check /proc/sys/kernel/perf_event_paranoid (needs <= 2) or run outside a"
+             << " container/VM. Showing timings only.\n" << endl;
+    }
+    
+    cout << setw(16) << "Algorithm" << setw(11) << "Time (ms)" << setw(9) << "ns";
+    const char* columns[] = {"cycles", "instr", "IPC", "br-miss", "L1d-miss", "LLC-miss", "dTLB-miss"};
+    for (const char* column : columns) cout << setw(11) << column;
+    cout << endl;
+    cout << string(36 + 11 * 7, '-') << endl;
+    
+    vector<int> input = generateInput(dist, size, inputSeed), work;
+    for (const string& name : algorithms) {
+        const SortAlgorithm* algorithm = findSortAlgorithm(name);
+        bool risky = algorithm->quadratic || (algorithm->quadraticWorstCase && dist != "random");
+        if (risky && size > QUADRATIC_SIZE_LIMIT) {
+            cout << setw(16) << name << "  skipped (quadratic)" << endl;
+            continue;
+        }
+        
+        // Keep the counts of the fastest run
+        double bestNs = -1;
+        double best[PerfCounters::EVENT_COUNT];
+        for (int run = 0; run < trials; run++) {
+            double ns = measureCounters(algorithm->sort, input, work, counters);
+            if (bestNs < 0 || ns < bestNs) {
+                bestNs = ns;
+                for (int e = 0; e < PerfCounters::EVENT_COUNT; e++) {
+                    best[e] = counters.value((PerfCounters::Event)e);
+                }
+            }
+        }
+        
+        cout << setw(16) << name << fixed << setprecision(2) << setw(11) << bestNs / 1e6
+             << setw(9) << bestNs / size;
+        for (int e = 0; e < PerfCounters::EVENT_COUNT; e++) {
+            if (e == PerfCounters::BRANCH_MISSES) {
+                // IPC column sits between instructions and branch misses
+                double cycles = best[PerfCounters::CYCLES], instructions = best[PerfCounters::INSTRUCTIONS];
+                if (cycles > 0 && instructions >= 0) cout << setw(11) << instructions / cycles;
+                else cout << setw(11) << "n/a";
+            }
+            if (best[e] < 0) cout << setw(11) << "n/a";
+            else cout << setw(11) << setprecision(e >= PerfCounters::BRANCH_MISSES ? 3 : 2) << best[e] / size;
+        }
+        cout << endl;
+    }
+    
+    cout << "\nCounts are per element and cover the calling thread only"
+         << " (parallel engines: worker threads are not counted)." << endl;
+    return 0;
+}
+
+void listAlgorithms() {
+    cout << "Algorithms:";
+    for (const SortAlgorithm& algorithm : sortAlgorithms()) cout << " " << algorithm.name;
+    cout << "\nDistributions:";
+    for (const string& dist : inputDistributions()) cout << " " << dist;
+    cout << endl;
+}
+
+void printUsage(const char* program) {
+    cout << "Usage:" << endl;
+    cout << "  " << program << endl;
+    cout << "      Compare all algorithms" << endl;
+    cout << "  " << program << " --parallel [size] [threads]" << endl;
+    cout << "      Thread scaling of parallel merge sort (1, 2, 4, ... threads)" << endl;
+    cout << "  " << program << " --sample [maxSize]" << endl;
+    cout << "      Sample sort vs other engines, sizes x10 up to maxSize (default: RAM / 2)" << endl;
+    cout << "  " << program << " --presorted [size]" << endl;
+    cout << "      Timsort vs merge sort on sorted, reversed and nearly sorted input" << endl;
+    cout << "  " << program << " --generic [size]" << endl;
+    cout << "      Template sorts on int, int64, float and string keys of a struct" << endl;
+    cout << "  " << program << " --indirect [size]" << endl;
+    cout << "      Direct sort vs key-index sort for 16-256 byte records" << endl;
+    cout << "  " << program << " --select [size]" << endl;
+    cout << "      nth element, partial sort, streaming and parallel top-k vs full sort" << endl;
+    cout << "  " << program << " --select-file <file> <k>" << endl;
+    cout << "      k smallest ints of a binary file with a bounded heap (one pass)" << endl;
+    cout << "  " << program << " --simd" << endl;
+    cout << "      AVX2 sorting-network base case vs insertion sort" << endl;
+    cout << "  " << program << " --generate <file> <count> [seed]" << endl;
+    cout << "      Write count random 32-bit ints to a binary file" << endl;
+    cout << "  " << program << " --external <input> <output> [memoryMB] [fanIn] [engine]" << endl;
+    cout << "      External merge sort of a binary int file (defaults: 256 MB, fan-in 64, radix)" << endl;
+    cout << "      Engine: any algorithm name listed by --list" << endl;
+    cout << "  " << program << " --bench [options]" << endl;
+    cout << "      Repeated trials with median/p95/min timings" << endl;
+    cout << "      --algos a,b,...   algorithms (default: all)" << endl;
+    cout << "      --dist d,...      input distributions (default: random)" << endl;
+    cout << "      --sizes n,...     array sizes (default: 100000)" << endl;
+    cout << "      --trials N        measured trials (default: 10)" << endl;
+    cout << "      --warmup N        unmeasured warmup runs (default: 2)" << endl;
+    cout << "      --seed S          input seed (default: 42)" << endl;
+    cout << "      --format F        table, csv or json (default: table)" << endl;
+    cout << "      --out FILE        write results to FILE instead of stdout" << endl;
+    cout << "  " << program << " --sweep [options]" << endl;
+    cout << "      Size scaling and strong/weak thread scaling" << endl;
+    cout << "      --algos a,b,...   algorithms (default: all)" << endl;
+    cout << "      --dist D          input distribution (default: random)" << endl;
+    cout << "      --min-size N      first size (default: 1000)" << endl;
+    cout << "      --factor F        size growth per step (default: 10)" << endl;
+    cout << "      --max-size N      last size (default: memory budget)" << endl;
+    cout << "      --memory MB       memory budget (default: RAM / 2)" << endl;
+    cout << "      --time-budget S   drop an algorithm when its next run would exceed S seconds (default: 2)" << endl;
+    cout << "      --threads t,...   thread counts for parallel engines (default: 1, 2, 4, ... all)" << endl;
+    cout << "      --weak-size N     elements per thread for weak scaling (default: 1000000)" << endl;
+    cout << "      --trials N        trials per point, median reported (default: 3)" << endl;
+    cout << "      --seed S, --format table|csv, --out FILE" << endl;
+    cout << "  " << program << " --compare <baseline> <current> [alpha] [threshold%]" << endl;
+    cout << "      Report statistically significant changes between two CSV or JSON result files" << endl;
+    cout << "      (defaults: 0.05, 2%)" << endl;
+    cout << "  " << program << " --counters [size] [distribution] [algos]" << endl;
+    cout << "      Cycles, instructions, branch/cache/TLB misses per element (Linux perf)" << endl;
+    cout << "  " << program << " --list" << endl;
+    cout << "      List algorithms and input distributions" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    // Machine-readable modes print no banner
+    if (argc > 1) {
+        string mode = argv[1];
+        if (mode == "--bench") return runBenchmarkMode(argc, argv);
+        if (mode == "--compare") return runCompareMode(argc, argv);
+        if (mode == "--sweep") return runSweepMode(argc, argv);
+        if (mode == "--list") {
+            listAlgorithms();
+            return 0;
+        }
+    }
+    
     cout << "========================================" << endl;
     cout << "Sorting Algorithms Comparison Tool" << endl;
     cout << "========================================\n" << endl;
     
+    if (argc > 1) {
+        string mode = argv[1];
+        if (mode == "--parallel") {
+            int size = (argc > 2) ? atoi(argv[2]) : 10000000;
+            int threads = (argc > 3) ? atoi(argv[3]) : hardwareThreads();
+            runParallelBenchmark(size, max(threads, 1));
+            return 0;
+        }
+        if (mode == "--sample") {
+            long long maxSize = (argc > 2) ? atoll(argv[2]) : 0;
+            runSampleSortBenchmark(maxSize);
+            return 0;
+        }
+        if (mode == "--presorted") {
+            int size = (argc > 2) ? atoi(argv[2]) : 1000000;
+            runPresortedBenchmark(max(size, 1));
+            return 0;
+        }
+        if (mode == "--counters") {
+            return runCountersMode(argc, argv);
+        }
+        if (mode == "--generic") {
+            int size = (argc > 2) ? atoi(argv[2]) : 1000000;
+            runGenericBenchmark(max(size, 1));
+            return 0;
+        }
+        if (mode == "--indirect") {
+            int size = (argc > 2) ? atoi(argv[2]) : 500000;
+            runIndirectBenchmark(max(size, 1));
+            return 0;
+        }
+        if (mode == "--select") {
+            int size = (argc > 2) ? atoi(argv[2]) : 10000000;
+            runSelectionBenchmark(max(size, 1));
+            return 0;
+        }
+        if (mode == "--select-file" && argc > 3) {
+            return runSelectFile(argv[2], max(atoi(argv[3]), 1));
+        }
+        if (mode == "--simd") {
+            runSimdBenchmark();
+            return 0;
+        }
+        if (mode == "--generate" && argc > 3) {
+            unsigned int seed = (argc > 4) ? (unsigned int)atoll(argv[4]) : 12345;
+            if (!generateIntFile(argv[2], atoll(argv[3]), seed)) {
+                cout << "Error: cannot write " << argv[2] << endl;
+                return 1;
+            }
+            cout << "Wrote " << argv[3] << " ints to " << argv[2] << endl;
+            return 0;
+        }
+        if (mode == "--external" && argc > 3) {
+            long long memoryMB = (argc > 4) ? atoll(argv[4]) : 256;
+            int fanIn = (argc > 5) ? atoi(argv[5]) : 64;
+            string engine = (argc > 6) ? argv[6] : "radix";
+            return runExternalSort(argv[2], argv[3], max(memoryMB, 1LL), max(fanIn, 2), engine);
+        }
+        printUsage(argv[0]);
+        return 1;
+    }
+    
     // Test different array sizes
     vector<int> sizes = {100, 500, 1000, 5000, 10000};
     
     cout << setw(15) << "Array Size" << setw(15) << "Bubble" << setw(15) 
          << "Insertion" << setw(15) << "Selection" << setw(15) 
-         << "Merge" << setw(15) << "Quick" << endl;
-    cout << string(90, '-') << endl;
+         << "Merge" << setw(15) << "Merge (BU)" << setw(15) << "Quick" << setw(15) << "Quick (Block)"
+         << setw(15) << "Introsort" << setw(15) << "Radix" << endl;
+    cout << string(150, '-') << endl;
     
     for (int size : sizes) {
         vector<int> arr = generateRandomArray(size);
@@ -169,18 +2463,45 @@ int main() {
         double insertionTime = measureTime(insertionSort, arr);
         double selectionTime = measureTime(selectionSort, arr);
         double mergeTime = measureTimeMerge(mergeSort, arr);
+        double mergeBottomUpTime = measureTime(mergeSortBottomUp, arr);
         double quickTime = measureTimeQuick(quickSort, arr);
+        double quickBlockTime = measureTimeQuick(quickSortBlock, arr);
+        double introTime = measureTimeQuick(introSort, arr);
+        double radixTime = measureTime(radixSort, arr);
         
         cout << setw(15) << size 
              << setw(15) << fixed << setprecision(2) << bubbleTime << " ms"
              << setw(15) << insertionTime << " ms"
              << setw(15) << selectionTime << " ms"
              << setw(15) << mergeTime << " ms"
-             << setw(15) << quickTime << " ms" << endl;
+             << setw(15) << mergeBottomUpTime << " ms"
+             << setw(15) << quickTime << " ms"
+             << setw(15) << quickBlockTime << " ms"
+             << setw(15) << introTime << " ms"
+             << setw(15) << radixTime << " ms" << endl;
     }
     
     cout << "\nNote: Times are in milliseconds (ms)" << endl;
     
+    // Partition kernels on larger arrays (same pivot rule, so only the kernel differs)
+    cout << "\nBlock partition vs Lomuto partition (random keys):" << endl;
+    cout << setw(15) << "Array Size" << setw(15) << "Lomuto" << setw(15)
+         << "Block" << setw(15) << "Speedup" << endl;
+    cout << string(60, '-') << endl;
+    
+    vector<int> kernelSizes = {10000, 100000, 1000000};
+    for (int size : kernelSizes) {
+        vector<int> arr = generateRandomArray(size);
+        
+        double lomutoTime = measureTimeQuick(quickSort, arr);
+        double blockTime = measureTimeQuick(quickSortBlock, arr);
+        
+        cout << setw(15) << size
+             << setw(12) << fixed << setprecision(2) << lomutoTime << " ms"
+             << setw(12) << blockTime << " ms"
+             << setw(14) << lomutoTime / max(blockTime, 0.001) << "x" << endl;
+    }
+    
     return 0;
 }
 
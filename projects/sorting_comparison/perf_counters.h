@@ -0,0 +1,181 @@
+/*
+ * Hardware Performance Counters (Linux perf_event_open)
+ *
+ * PerfCounters opens one counter per event for the calling thread:
+ * cycles, instructions, branch mispredictions, L1 data cache misses,
+ * last-level cache misses and data TLB misses.
+ *
+ * Every counter is opened on its own, so an event the CPU or kernel does
+ * not support only disables that column. If nothing can be opened
+ * (non-Linux system, perf_event_paranoid too strict, container without
+ * access, VM without a PMU) available() is false and callers fall back to
+ * plain timings.
+ *
+ * When more events are requested than the PMU has registers, the kernel
+ * multiplexes them; the counts are scaled by time_enabled / time_running.
+ *
+ * Usage:
+ *     PerfCounters counters;
+ *     counters.start();
+ *     sortFunc(arr);
+ *     counters.stop();
+ *     double misses = counters.value(PerfCounters::BRANCH_MISSES);
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+class PerfCounters {
+public:
+    enum Event {
+        CYCLES,
+        INSTRUCTIONS,
+        BRANCH_MISSES,
+        L1D_MISSES,
+        LLC_MISSES,
+        DTLB_MISSES,
+        EVENT_COUNT
+    };
+
+    static const char* eventName(int event) {
+        static const char* names[EVENT_COUNT] = {
+            "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses", "dTLB-misses"
+        };
+        return names[event];
+    }
+
+#ifdef __linux__
+    PerfCounters() : openCount(0) {
+        for (int i = 0; i < EVENT_COUNT; i++) {
+            fds[i] = -1;
+            values[i] = -1;
+        }
+
+        for (int i = 0; i < EVENT_COUNT; i++) {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            configure(i, attr);
+
+            fds[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+            if (fds[i] >= 0) {
+                openCount++;
+            } else if (error.empty()) {
+                error = std::string("perf_event_open: ") + std::strerror(errno);
+            }
+        }
+    }
+
+    ~PerfCounters() {
+        for (int i = 0; i < EVENT_COUNT; i++) {
+            if (fds[i] >= 0) close(fds[i]);
+        }
+    }
+
+    void start() {
+        for (int i = 0; i < EVENT_COUNT; i++) {
+            if (fds[i] < 0) continue;
+            ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+
+    void stop() {
+        for (int i = 0; i < EVENT_COUNT; i++) {
+            if (fds[i] >= 0) ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (int i = 0; i < EVENT_COUNT; i++) {
+            values[i] = -1;
+            if (fds[i] < 0) continue;
+
+            // value, time_enabled, time_running
+            uint64_t data[3];
+            if (read(fds[i], data, sizeof(data)) != (ssize_t)sizeof(data) || data[2] == 0) continue;
+            values[i] = (double)data[0] * ((double)data[1] / (double)data[2]);
+        }
+    }
+#else
+    PerfCounters() : openCount(0), error("hardware counters need Linux perf_event_open") {
+        for (int i = 0; i < EVENT_COUNT; i++) values[i] = -1;
+    }
+
+    void start() {}
+    void stop() {}
+#endif
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // True if at least one counter could be opened
+    bool available() const {
+        return openCount > 0;
+    }
+
+    // Why counters are missing (empty if all opened)
+    const std::string& lastError() const {
+        return error;
+    }
+
+    // Count between the last start() and stop(), or -1 if unavailable
+    double value(Event event) const {
+        return values[event];
+    }
+
+private:
+#ifdef __linux__
+    static void configure(int event, struct perf_event_attr& attr) {
+        // Generic cache events: cache id | (operation << 8) | (result << 16)
+        const uint64_t readMiss = (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        switch (event) {
+            case CYCLES:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case INSTRUCTIONS:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case BRANCH_MISSES:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            case L1D_MISSES:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_L1D | readMiss;
+                break;
+            case LLC_MISSES:
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            default:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_DTLB | readMiss;
+                break;
+        }
+    }
+
+    int fds[EVENT_COUNT];
+#endif
+    int openCount;
+    std::string error;
+    double values[EVENT_COUNT];
+};
+
+#endif
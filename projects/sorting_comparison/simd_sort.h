@@ -0,0 +1,266 @@
+/*
+ * SIMD Sorting Kernels (AVX2) for small base cases
+ *
+ * - sortSmall(data, n): sorts up to 64 ints with a bitonic sorting network
+ *   held in 1, 2, 4 or 8 AVX2 registers (8/16/32/64 ints). Shorter inputs
+ *   are padded with INT_MAX.
+ * - mergeSortedRuns(a, na, b, nb, dst): merges two sorted runs 8 elements
+ *   at a time with an in-register bitonic merge network.
+ *
+ * The kernels are compiled with a function-level target attribute, so the
+ * program itself needs no -mavx2 flag. The CPU is checked once at runtime;
+ * without AVX2 (or on non-GCC/Clang compilers) the scalar fallbacks are
+ * used: insertion sort and a plain two-way merge.
+ */
+
+#ifndef SIMD_SORT_H
+#define SIMD_SORT_H
+
+#include <algorithm>
+#include <climits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_SORT_HAS_AVX2 1
+#include <immintrin.h>
+#define SIMD_SORT_AVX2 __attribute__((target("avx2")))
+#else
+#define SIMD_SORT_HAS_AVX2 0
+#endif
+
+// Largest input handled by sortSmall
+const int SIMD_NETWORK_MAX = 64;
+
+// Scalar fallback: insertion sort
+inline void sortSmallScalar(int* data, int n) {
+    for (int i = 1; i < n; i++) {
+        int key = data[i];
+        int j = i - 1;
+        while (j >= 0 && data[j] > key) {
+            data[j + 1] = data[j];
+            j--;
+        }
+        data[j + 1] = key;
+    }
+}
+
+// Scalar fallback: two-way merge
+inline void mergeSortedRunsScalar(const int* a, int na, const int* b, int nb, int* dst) {
+    int i = 0, j = 0;
+    while (i < na && j < nb) {
+        *dst++ = (b[j] < a[i]) ? b[j++] : a[i++];
+    }
+    dst = std::copy(a + i, a + na, dst);
+    std::copy(b + j, b + nb, dst);
+}
+
+#if SIMD_SORT_HAS_AVX2
+
+// One compare-exchange stage: every lane is compared with the matching lane
+// of partner; lanes set in Mask keep the max, the others keep the min
+template <int Mask>
+SIMD_SORT_AVX2 inline __m256i networkStage(__m256i v, __m256i partner) {
+    __m256i lo = _mm256_min_epi32(v, partner);
+    __m256i hi = _mm256_max_epi32(v, partner);
+    return _mm256_blend_epi32(lo, hi, Mask);
+}
+
+SIMD_SORT_AVX2 inline __m256i reverse8(__m256i v) {
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+// Sort a bitonic sequence of 8 lanes (distance 4, 2, 1)
+SIMD_SORT_AVX2 inline __m256i bitonicMerge8(__m256i v) {
+    v = networkStage<0xF0>(v, _mm256_permute2x128_si256(v, v, 0x01));
+    v = networkStage<0xCC>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = networkStage<0xAA>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return v;
+}
+
+// Sort 8 lanes: sort pairs, merge into 4s, merge into 8
+SIMD_SORT_AVX2 inline __m256i sort8(__m256i v) {
+    v = networkStage<0xAA>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = networkStage<0xCC>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3)));
+    v = networkStage<0xAA>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = networkStage<0xF0>(v, reverse8(v));
+    v = networkStage<0xCC>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = networkStage<0xAA>(v, _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return v;
+}
+
+// Merge two sorted registers: a receives the 8 smallest, b the 8 largest
+SIMD_SORT_AVX2 inline void mergeRegisters(__m256i& a, __m256i& b) {
+    __m256i reversed = reverse8(b);
+    __m256i lo = _mm256_min_epi32(a, reversed);
+    __m256i hi = _mm256_max_epi32(a, reversed);
+    a = bitonicMerge8(lo);
+    b = bitonicMerge8(hi);
+}
+
+// Sort a bitonic sequence spread over Count registers
+template <int Count>
+SIMD_SORT_AVX2 inline void bitonicMergeRegisters(__m256i* r) {
+    for (int stride = Count / 2; stride >= 1; stride /= 2) {
+        for (int i = 0; i < Count; i++) {
+            if ((i & stride) == 0) {
+                __m256i lo = _mm256_min_epi32(r[i], r[i + stride]);
+                __m256i hi = _mm256_max_epi32(r[i], r[i + stride]);
+                r[i] = lo;
+                r[i + stride] = hi;
+            }
+        }
+    }
+    for (int i = 0; i < Count; i++) r[i] = bitonicMerge8(r[i]);
+}
+
+// Merge two sorted runs of Run registers each (a = r[0..Run-1], b = r[Run..2*Run-1])
+template <int Run>
+SIMD_SORT_AVX2 inline void mergeRegisterRuns(__m256i* r) {
+    __m256i lo[Run], hi[Run];
+    for (int j = 0; j < Run; j++) {
+        // Element k of a meets element (last - k) of b
+        __m256i reversed = reverse8(r[2 * Run - 1 - j]);
+        lo[j] = _mm256_min_epi32(r[j], reversed);
+        hi[j] = _mm256_max_epi32(r[j], reversed);
+    }
+    for (int j = 0; j < Run; j++) {
+        r[j] = lo[j];
+        r[Run + j] = hi[j];
+    }
+    bitonicMergeRegisters<Run>(r);
+    bitonicMergeRegisters<Run>(r + Run);
+}
+
+// Sort exactly 8 * Count ints in registers
+template <int Count>
+SIMD_SORT_AVX2 inline void sortNetworkRegisters(int* data) {
+    __m256i r[Count];
+    for (int i = 0; i < Count; i++) {
+        r[i] = sort8(_mm256_loadu_si256((const __m256i*)(data + 8 * i)));
+    }
+    if (Count >= 2) {
+        for (int i = 0; i < Count; i += 2) mergeRegisterRuns<1>(r + i);
+    }
+    if (Count >= 4) {
+        for (int i = 0; i < Count; i += 4) mergeRegisterRuns<(Count >= 4 ? 2 : 1)>(r + i);
+    }
+    if (Count >= 8) {
+        mergeRegisterRuns<(Count >= 8 ? 4 : 1)>(r);
+    }
+    for (int i = 0; i < Count; i++) {
+        _mm256_storeu_si256((__m256i*)(data + 8 * i), r[i]);
+    }
+}
+
+SIMD_SORT_AVX2 inline void sortSmallAvx2(int* data, int n) {
+    if (n < 2) return;
+
+    // Exact network sizes sort in place, the rest go through a padded copy
+    if (n == 8) { sortNetworkRegisters<1>(data); return; }
+    if (n == 16) { sortNetworkRegisters<2>(data); return; }
+    if (n == 32) { sortNetworkRegisters<4>(data); return; }
+    if (n == 64) { sortNetworkRegisters<8>(data); return; }
+
+    int padded[SIMD_NETWORK_MAX];
+    int size = (n <= 8) ? 8 : (n <= 16) ? 16 : (n <= 32) ? 32 : 64;
+    std::copy(data, data + n, padded);
+    std::fill(padded + n, padded + size, INT_MAX);
+
+    switch (size) {
+        case 8: sortNetworkRegisters<1>(padded); break;
+        case 16: sortNetworkRegisters<2>(padded); break;
+        case 32: sortNetworkRegisters<4>(padded); break;
+        default: sortNetworkRegisters<8>(padded); break;
+    }
+    std::copy(padded, padded + n, data);
+}
+
+SIMD_SORT_AVX2 inline void mergeSortedRunsAvx2(const int* a, int na, const int* b, int nb, int* dst) {
+    if (na < 8 || nb < 8) {
+        mergeSortedRunsScalar(a, na, b, nb, dst);
+        return;
+    }
+
+    __m256i lo = _mm256_loadu_si256((const __m256i*)a);
+    __m256i hi = _mm256_loadu_si256((const __m256i*)b);
+    int i = 8, j = 8;
+    mergeRegisters(lo, hi);
+    _mm256_storeu_si256((__m256i*)dst, lo);
+    dst += 8;
+
+    // hi holds the 8 largest seen so far; refill from the run with the smaller head
+    while (true) {
+        bool fromA = (j == nb) || (i < na && a[i] <= b[j]);
+        if (fromA ? (na - i < 8) : (nb - j < 8)) break;
+
+        __m256i next;
+        if (fromA) {
+            next = _mm256_loadu_si256((const __m256i*)(a + i));
+            i += 8;
+        } else {
+            next = _mm256_loadu_si256((const __m256i*)(b + j));
+            j += 8;
+        }
+        mergeRegisters(next, hi);
+        _mm256_storeu_si256((__m256i*)dst, next);
+        dst += 8;
+    }
+
+    // Tail: the 8 held values plus fewer than 8 left in one run go through
+    // a small buffer, which is then merged with the rest of the other run
+    int held[8];
+    _mm256_storeu_si256((__m256i*)held, hi);
+    int small[16];
+    bool aIsShort = (na - i < 8) && ((j == nb) || (i < na && a[i] <= b[j]));
+    if (aIsShort) {
+        mergeSortedRunsScalar(held, 8, a + i, na - i, small);
+        mergeSortedRunsScalar(small, 8 + na - i, b + j, nb - j, dst);
+    } else {
+        mergeSortedRunsScalar(held, 8, b + j, nb - j, small);
+        mergeSortedRunsScalar(small, 8 + nb - j, a + i, na - i, dst);
+    }
+}
+
+inline bool cpuHasAvx2() {
+    static const bool hasAvx2 = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return hasAvx2;
+}
+
+#else
+
+inline bool cpuHasAvx2() {
+    return false;
+}
+
+#endif
+
+// Name of the kernels selected for this CPU
+inline const char* simdKernelName() {
+    return cpuHasAvx2() ? "AVX2" : "scalar";
+}
+
+// Sort data[0..n-1], n <= SIMD_NETWORK_MAX
+inline void sortSmall(int* data, int n) {
+#if SIMD_SORT_HAS_AVX2
+    if (cpuHasAvx2()) {
+        sortSmallAvx2(data, n);
+        return;
+    }
+#endif
+    sortSmallScalar(data, n);
+}
+
+// Merge sorted a[0..na-1] and b[0..nb-1] into dst
+inline void mergeSortedRuns(const int* a, int na, const int* b, int nb, int* dst) {
+#if SIMD_SORT_HAS_AVX2
+    if (cpuHasAvx2()) {
+        mergeSortedRunsAvx2(a, na, b, nb, dst);
+        return;
+    }
+#endif
+    mergeSortedRunsScalar(a, na, b, nb, dst);
+}
+
+#endif
@@ -0,0 +1,192 @@
+/*
+ * Work-Stealing Thread Pool
+ *
+ * Each thread owns a task deque. A thread pushes and pops its own tasks
+ * at the back (LIFO, cache-friendly for divide and conquer) and steals
+ * from the front of other deques (FIFO, takes the largest pending pieces).
+ *
+ * The pool is created with N threads in total: N - 1 worker threads plus
+ * the calling thread, which runs tasks while it waits in TaskGroup::wait().
+ * A pool of 1 therefore runs everything on the caller.
+ *
+ * Fork-join usage:
+ *     TaskGroup group(pool);
+ *     group.run([&] { sortLeftHalf(); });
+ *     sortRightHalf();
+ *     group.wait();   // helps with other tasks instead of blocking
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int numThreads) : queuedTasks(0), stopping(false) {
+        if (numThreads < 1) numThreads = 1;
+
+        // Queue 0 belongs to threads outside the pool (the caller)
+        for (int i = 0; i < numThreads; i++) {
+            queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+        }
+        for (int i = 1; i < numThreads; i++) {
+            workers.push_back(std::thread(&WorkStealingPool::workerLoop, this, i));
+        }
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Total number of threads, including the caller
+    int threadCount() const {
+        return (int)queues.size();
+    }
+
+    // Push a task onto the current thread's deque
+    void submit(std::function<void()> task) {
+        WorkQueue& queue = *queues[currentIndex()];
+        {
+            std::lock_guard<std::mutex> guard(queue.lock);
+            queue.tasks.push_back(std::move(task));
+        }
+        queuedTasks++;
+        {
+            std::lock_guard<std::mutex> guard(sleepLock);
+        }
+        wakeUp.notify_one();
+    }
+
+    // Run one pending task (own deque first, then steal)
+    // Returns false if no task was available
+    bool runPendingTask() {
+        int index = currentIndex();
+        std::function<void()> task;
+        if (popLocal(index, task) || steal(index, task)) {
+            task();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    struct WorkQueue {
+        std::mutex lock;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    struct ThreadSlot {
+        const WorkStealingPool* pool;
+        int index;
+    };
+
+    static ThreadSlot& currentSlot() {
+        static thread_local ThreadSlot slot = {nullptr, 0};
+        return slot;
+    }
+
+    int currentIndex() const {
+        const ThreadSlot& slot = currentSlot();
+        return (slot.pool == this) ? slot.index : 0;
+    }
+
+    bool popLocal(int index, std::function<void()>& task) {
+        WorkQueue& queue = *queues[index];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (queue.tasks.empty()) return false;
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        queuedTasks--;
+        return true;
+    }
+
+    bool steal(int thief, std::function<void()>& task) {
+        int n = (int)queues.size();
+        for (int k = 1; k < n; k++) {
+            WorkQueue& queue = *queues[(thief + k) % n];
+            std::lock_guard<std::mutex> guard(queue.lock);
+            if (queue.tasks.empty()) continue;
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            queuedTasks--;
+            return true;
+        }
+        return false;
+    }
+
+    void workerLoop(int index) {
+        currentSlot().pool = this;
+        currentSlot().index = index;
+
+        while (true) {
+            if (runPendingTask()) continue;
+
+            // Sleep until something is queued or the pool shuts down
+            std::unique_lock<std::mutex> guard(sleepLock);
+            wakeUp.wait(guard, [this] { return stopping || queuedTasks.load() > 0; });
+            if (stopping && queuedTasks.load() == 0) return;
+        }
+    }
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+    std::atomic<int> queuedTasks;
+    bool stopping;
+};
+
+// Group of forked tasks that can be joined with wait()
+class TaskGroup {
+public:
+    explicit TaskGroup(WorkStealingPool& pool) : pool(pool), pending(0) {}
+
+    ~TaskGroup() {
+        wait();
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template <typename Task>
+    void run(Task task) {
+        pending++;
+        pool.submit([this, task]() {
+            task();
+            pending--;
+        });
+    }
+
+    // Wait for all tasks of this group, running other tasks meanwhile
+    void wait() {
+        while (pending.load() > 0) {
+            if (!pool.runPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    WorkStealingPool& pool;
+    std::atomic<int> pending;
+};
+
+#endif